@@ -0,0 +1,237 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "fmi4cpp/fmi2/xml/ModelDescriptionParser.hpp"
+
+#include "synthetic_model.hpp"
+
+using namespace std;
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    const double LOOKUP_BUDGET_SECONDS = 0.5;
+    const size_t MAX_LOOKUPS = 100000;
+
+    // high water mark of the resident set size, in MB
+    double peakRss() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+        return counters.PeakWorkingSetSize / 1e6;
+#elif defined(__linux__)
+        ifstream status("/proc/self/status");
+        string line;
+        while (getline(status, line)) {
+            if (line.compare(0, 6, "VmHWM:") == 0) {
+                return stod(line.substr(6)) / 1e3;
+            }
+        }
+        return 0;
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1e6;
+#else
+        return usage.ru_maxrss / 1e3;
+#endif
+#endif
+    }
+
+    // lets every model size report its own peak, where the OS supports it
+    void resetPeakRss() {
+#ifdef __linux__
+        ofstream("/proc/self/clear_refs") << "5";
+#endif
+    }
+
+    double millisSince(chrono::steady_clock::time_point start) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+
+    // median and 99th percentile latency in ns, over as many of 'keys' as fit in the time budget
+    template<typename Key>
+    pair<double, double> lookupLatency(const vector<Key> &keys, const function<void(const Key &)> &lookup) {
+        vector<double> samples;
+        samples.reserve(keys.size());
+        const auto start = chrono::steady_clock::now();
+        for (const auto &key : keys) {
+            const auto t = chrono::steady_clock::now();
+            lookup(key);
+            samples.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - t).count());
+            if (samples.size() >= 10 && millisSince(start) > LOOKUP_BUDGET_SECONDS * 1e3) {
+                break;
+            }
+        }
+        sort(samples.begin(), samples.end());
+        return {samples[samples.size() / 2], samples[samples.size() * 99 / 100]};
+    }
+
+    void run(size_t numVariables) {
+
+        auto xml = make_shared<const string>(generateModelDescription(numVariables));
+
+        resetPeakRss();
+        const double rssBefore = peakRss();
+
+        auto start = chrono::steady_clock::now();
+        const auto md = pullModelDescription(xml);
+        const double headerMs = millisSince(start);
+
+        start = chrono::steady_clock::now();
+        const auto &mv = md->modelVariables();
+        const double variablesMs = millisSince(start);
+
+        start = chrono::steady_clock::now();
+        const auto &ms = md->modelStructure();
+        const double structureMs = millisSince(start);
+
+        start = chrono::steady_clock::now();
+        const auto &graphs = md->dependencyGraphs();
+        const double graphMs = millisSince(start);
+
+        start = chrono::steady_clock::now();
+        const auto &catalogue = md->variableCatalogue();
+        const double catalogueMs = millisSince(start);
+
+        const double rss = peakRss();
+
+        // a whole-model filter, through the variables and through the catalogue
+        size_t outputs = 0;
+        start = chrono::steady_clock::now();
+        for (const auto &v : *mv) {
+            outputs += v.causality() == Causality::output;
+        }
+        const double scanVariablesUs = millisSince(start) * 1e3;
+        start = chrono::steady_clock::now();
+        for (const auto causality : catalogue->causalities()) {
+            outputs -= causality == Causality::output;
+        }
+        const double scanCatalogueUs = millisSince(start) * 1e3;
+        start = chrono::steady_clock::now();
+        outputs += catalogue->withCausality(Causality::output).count();
+        const double scanBitsetUs = millisSince(start) * 1e3;
+        for (const auto &v : *mv) {
+            outputs -= v.causality() == Causality::output;
+        }
+        if (outputs != 0) {
+            throw runtime_error("the catalogue disagrees with the variables");
+        }
+
+        // one port of every component of one subsystem, through the name tree
+        const string pattern = "system.subsystem" + to_string((numVariables - 1) / 2000) + ".*.port1";
+        start = chrono::steady_clock::now();
+        mv->nameTree();
+        const double nameTreeMs = millisSince(start);
+        start = chrono::steady_clock::now();
+        const auto selected = mv->select(pattern).size();
+        const double selectUs = millisSince(start) * 1e3;
+
+        mt19937 rng(42);
+        uniform_int_distribution<size_t> pick(0, mv->size() - 1);
+        vector<string> names;
+        vector<fmi2ValueReference> valueReferences;
+        for (size_t i = 0; i < min(MAX_LOOKUPS, mv->size()); i++) {
+            const auto &v = (*mv)[pick(rng)];
+            names.emplace_back(v.name());
+            valueReferences.push_back(v.valueReference());
+        }
+
+        const auto byName = lookupLatency<string>(names, [&](const string &name) {
+            if (mv->getByName(name).name() != name) {
+                throw runtime_error("getByName returned the wrong variable");
+            }
+        });
+        const auto byValueReference = lookupLatency<fmi2ValueReference>(valueReferences, [&](fmi2ValueReference vr) {
+            if (mv->getByValueReference(vr).valueReference() != vr) {
+                throw runtime_error("getByValueReference returned the wrong variable");
+            }
+        });
+
+        cout << fixed << setprecision(1)
+             << setw(9) << numVariables
+             << setw(10) << xml->size() / 1e6
+             << setw(10) << headerMs
+             << setw(12) << variablesMs
+             << setw(12) << structureMs
+             << setw(10) << graphMs
+             << setw(11) << catalogueMs
+             << setw(12) << rss - rssBefore
+             << setw(12) << rss
+             << setprecision(0)
+             << setw(12) << byName.first << " /" << setw(10) << byName.second
+             << setw(12) << byValueReference.first << " /" << setw(10) << byValueReference.second
+             << setw(10) << ms->outputs().size() + ms->derivatives().size() + ms->initialUnknowns().size()
+             << setw(10) << graphs->outputs.numberOfEdges() + graphs->derivatives.numberOfEdges() +
+                            graphs->initialUnknowns.numberOfEdges()
+             << setw(11) << scanVariablesUs << " /" << setw(8) << scanCatalogueUs << " /" << setw(7) << scanBitsetUs
+             << setw(10) << nameTreeMs << setw(10) << selectUs << " (" << selected << ")" << endl;
+    }
+
+}
+
+int main(int argc, char **argv) {
+
+    vector<size_t> sizes;
+    for (int i = 1; i < argc; i++) {
+        sizes.push_back(stoul(argv[i]));
+        if (sizes.back() == 0) {
+            cout << "usage: fmi4cpp_bench [numVariables > 0]..." << endl;
+            return 1;
+        }
+    }
+    if (sizes.empty()) {
+        sizes = {1000, 10000, 100000, 1000000};
+    }
+
+    cout << "Synthetic modelDescription.xml, times in ms, memory in MB, lookup latency p50 / p99 in ns, "
+            "output scan over ModelVariables / VariableCatalogue columns / VariableCatalogue bitset in us, "
+            "name tree build in ms, select(\"system.subsystemN.*.port1\") in us (matches)" << endl;
+    cout << "variables    xml MB    header   variables   structure     graph  catalogue   RSS delta    peak RSS"
+            "       getByName p50 / p99  getByValueRef p50 / p99  unknowns     edges  outputs scan us           name tree select us" << endl;
+
+    for (const auto numVariables : sizes) {
+        run(numVariables);
+    }
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <new>
+#include <atomic>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+#include <fmi4cpp/fmi2/xml/ScalarVariableView.hpp>
+
+#include "fmi4cpp/fmi2/xml/ModelDescriptionParser.hpp"
+
+#include "synthetic_model.hpp"
+
+namespace {
+
+    std::atomic<size_t> liveBytes(0);
+
+    // every allocation carries its size in front of it
+    const size_t HEADER = alignof(std::max_align_t);
+
+}
+
+void *operator new(size_t size) {
+    auto *p = static_cast<char *>(std::malloc(size + HEADER));
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t *>(p) = size;
+    liveBytes += size;
+    return p + HEADER;
+}
+
+void operator delete(void *ptr) noexcept {
+    if (ptr != nullptr) {
+        auto *p = static_cast<char *>(ptr) - HEADER;
+        liveBytes -= *reinterpret_cast<size_t *>(p);
+        std::free(p);
+    }
+}
+
+using namespace std;
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    // the ScalarVariable layout before strings were interned: every variable owns its strings
+    template<typename T>
+    struct LegacyAttribute {
+        optional<T> start;
+        optional<string> declaredType;
+        optional<T> min;
+        optional<T> max;
+        optional<string> quantity;
+    };
+
+    struct LegacyRealAttribute : LegacyAttribute<double> {
+        bool reinit;
+        bool unbounded;
+        bool relativeQuantity;
+        optional<double> nominal;
+        optional<unsigned int> derivative;
+        optional<string> unit;
+        optional<string> displayUnit;
+    };
+
+    struct LegacyVariable {
+        string name;
+        string description;
+        fmi2ValueReference valueReference;
+        Causality causality;
+        Variability variability;
+        Initial initial;
+        bool canHandleMultipleSetPerTimelnstant;
+        optional<LegacyAttribute<int>> integer;
+        optional<LegacyRealAttribute> real;
+        optional<LegacyAttribute<string>> string_;
+        optional<LegacyAttribute<bool>> boolean;
+        optional<LegacyAttribute<int>> enumeration;
+    };
+
+    // the layout with one optional attribute per type, before they were merged into a variant
+    struct OptionalsVariable : ScalarVariableBase {
+        optional<IntegerAttribute> integer;
+        optional<RealAttribute> real;
+        optional<StringAttribute> string_;
+        optional<BooleanAttribute> boolean;
+        optional<EnumerationAttribute> enumeration;
+    };
+
+    optional<string> toString(const optional<string_view> &str) {
+        return str ? optional<string>(string(*str)) : nullopt;
+    }
+
+    template<typename T, typename U>
+    LegacyAttribute<T> toLegacy(const U &attribute) {
+        LegacyAttribute<T> legacy;
+        legacy.start = attribute.start;
+        legacy.declaredType = toString(attribute.declaredType);
+        return legacy;
+    }
+
+    template<typename T, typename U>
+    LegacyAttribute<T> toLegacyBounded(const U &attribute) {
+        LegacyAttribute<T> legacy = toLegacy<T>(attribute);
+        legacy.min = attribute.min;
+        legacy.max = attribute.max;
+        legacy.quantity = toString(attribute.quantity);
+        return legacy;
+    }
+
+    LegacyVariable toLegacy(const ScalarVariable &v) {
+        LegacyVariable legacy{string(v.name()), string(v.description()), v.valueReference(), v.causality(),
+                              v.variability(), v.initial(), v.canHandleMultipleSetPerTimelnstant()};
+        if (v.isReal()) {
+            const auto &attribute = v.asRealView().attribute();
+            LegacyRealAttribute real;
+            static_cast<LegacyAttribute<double> &>(real) = toLegacyBounded<double>(attribute);
+            real.reinit = attribute.reinit;
+            real.unbounded = attribute.unbounded;
+            real.relativeQuantity = attribute.relativeQuantity;
+            real.nominal = attribute.nominal;
+            real.derivative = attribute.derivative;
+            real.unit = toString(attribute.unit);
+            real.displayUnit = toString(attribute.displayUnit);
+            legacy.real = real;
+        } else if (v.isInteger()) {
+            legacy.integer = toLegacyBounded<int>(v.asIntegerView().attribute());
+        } else if (v.isString()) {
+            legacy.string_ = toLegacy<string>(v.asStringView().attribute());
+        } else if (v.isBoolean()) {
+            legacy.boolean = toLegacy<bool>(v.asBooleanView().attribute());
+        } else {
+            legacy.enumeration = toLegacyBounded<int>(v.asEnumerationView().attribute());
+        }
+        return legacy;
+    }
+
+}
+
+int main(int argc, char **argv) {
+
+    const size_t numVariables = argc > 1 ? stoul(argv[1]) : 100000;
+    const auto xml = make_shared<const string>(generateModelDescription(numVariables));
+
+    const size_t before = liveBytes;
+    auto md = parseModelDescriptionXml(xml);
+    const auto &variables = *md->modelVariables();
+    md->modelStructure();
+    const size_t interned = liveBytes - before;
+
+    const size_t beforeLegacy = liveBytes;
+    vector<LegacyVariable> legacy;
+    legacy.reserve(variables.size());
+    for (const auto &v : variables) {
+        legacy.push_back(toLegacy(v));
+    }
+    const size_t owned = liveBytes - beforeLegacy;
+
+    const double n = static_cast<double>(variables.size());
+    cout << variables.size() << " variables (" << xml->size() / 1e6 << " MB of XML)" << endl;
+    cout << "sizeof(ScalarVariable):                  " << sizeof(ScalarVariable) << " bytes (one optional per type "
+         << sizeof(OptionalsVariable) << ", owned strings " << sizeof(LegacyVariable) << ")" << endl;
+    cout << "model description, interned strings:     " << interned / n << " bytes/variable" << endl;
+    cout << "  of which string pool:                  " << variables.stringPool()->bytes() / n
+         << " bytes/variable" << endl;
+    cout << "variables with owned strings (baseline): " << owned / n << " bytes/variable" << endl;
+
+    return 0;
+}
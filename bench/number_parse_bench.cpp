@@ -0,0 +1,154 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <locale>
+#include <random>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iostream>
+#include <functional>
+
+#include "fmi4cpp/tools/number_parser.hpp"
+
+using namespace std;
+
+namespace {
+
+    // the implementations replaced by number_parser.hpp
+    void legacyParseDependencies(const string &str, vector<unsigned int> &store) {
+        int i;
+        stringstream ss(str);
+        while (ss >> i) {
+            store.push_back(i);
+            if (ss.peek() == ',' || ss.peek() == ' ') {
+                ss.ignore();
+            }
+        }
+    }
+
+    template<typename T>
+    bool legacyParseNumber(string_view raw, T &value) {
+        istringstream ss{string(raw)};
+        ss.imbue(locale::classic());
+        ss >> value;
+        if (!ss.eof()) {
+            ss >> ws;
+        }
+        return !ss.fail() && ss.get() == char_traits<char>::eof();
+    }
+
+    // best of 'iterations' runs, in nanoseconds per item
+    double run(const string &label, size_t items, int iterations, const function<size_t()> &body) {
+        double best = 1e300;
+        size_t checksum = 0;
+        for (int i = 0; i < iterations; i++) {
+            const auto start = chrono::steady_clock::now();
+            checksum += body();
+            const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+            best = min(best, elapsed.count() / items);
+        }
+        cout << "  " << label << ": " << best << " ns/item (checksum " << checksum << ")" << endl;
+        return best;
+    }
+
+}
+
+int main(int argc, char **argv) {
+
+    const size_t numDependencies = argc > 1 ? stoul(argv[1]) : 50000;
+    const int iterations = argc > 2 ? stoi(argv[2]) : 10;
+
+    mt19937 rng(42);
+
+    string dependencies;
+    for (size_t i = 0; i < numDependencies; i++) {
+        dependencies += to_string(1 + rng() % 1000000) + " ";
+    }
+
+    vector<string> reals;
+    vector<string> integers;
+    uniform_real_distribution<double> dist(-1e6, 1e6);
+    for (size_t i = 0; i < numDependencies; i++) {
+        ostringstream ss;
+        ss.precision(17);
+        ss << dist(rng);
+        reals.push_back(ss.str());
+        integers.push_back(to_string(static_cast<int>(rng() % 100000) - 50000));
+    }
+
+    cout << "Dependency list with " << numDependencies << " indices, best of " << iterations << endl;
+    const double legacyList = run("stringstream", numDependencies, iterations, [&] {
+        vector<unsigned int> store;
+        legacyParseDependencies(dependencies, store);
+        return store.size();
+    });
+    const double fastList = run("from_chars", numDependencies, iterations, [&] {
+        vector<unsigned int> store;
+        parseIndexList(dependencies, store);
+        return store.size();
+    });
+    cout << "  speedup: " << legacyList / fastList << "x" << endl;
+
+    cout << "Real attributes" << endl;
+    const double legacyReal = run("istringstream", reals.size(), iterations, [&] {
+        size_t ok = 0;
+        double value;
+        for (const auto &str : reals) {
+            ok += legacyParseNumber(str, value);
+        }
+        return ok;
+    });
+    const double fastReal = run("from_chars", reals.size(), iterations, [&] {
+        size_t ok = 0;
+        double value;
+        for (const auto &str : reals) {
+            ok += parseNumber<double>(str, value);
+        }
+        return ok;
+    });
+    cout << "  speedup: " << legacyReal / fastReal << "x" << endl;
+
+    cout << "Integer attributes" << endl;
+    const double legacyInt = run("istringstream", integers.size(), iterations, [&] {
+        size_t ok = 0;
+        int value;
+        for (const auto &str : integers) {
+            ok += legacyParseNumber(str, value);
+        }
+        return ok;
+    });
+    const double fastInt = run("from_chars", integers.size(), iterations, [&] {
+        size_t ok = 0;
+        int value;
+        for (const auto &str : integers) {
+            ok += parseNumber<int>(str, value);
+        }
+        return ok;
+    });
+    cout << "  speedup: " << legacyInt / fastInt << "x" << endl;
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_SYNTHETIC_MODEL_HPP
+#define FMI4CPP_SYNTHETIC_MODEL_HPP
+
+#include <string>
+#include <cstddef>
+
+namespace {
+
+    // modelDescription.xml with numVariables ScalarVariables, laid out like a large component-based model:
+    // hierarchical names, a handful of recurring descriptions, units and declared types, alias variables,
+    // and a ModelStructure where each output depends on a few states and every 30th variable is a derivative.
+    std::string generateModelDescription(size_t numVariables) {
+
+        static const char *quantities[][4] = {
+                // declaredType, quantity, unit, description
+                {"Modelica.SIunits.Temperature", "ThermodynamicTemperature", "K", "Temperature of the port"},
+                {"Modelica.SIunits.HeatFlowRate", "Power", "W", "Heat flow rate into the port"},
+                {"Modelica.SIunits.Pressure", "Pressure", "Pa", "Absolute pressure"},
+                {"Modelica.SIunits.MassFlowRate", "MassFlowRate", "kg/s", "Mass flow rate from port a to port b"},
+                {"Modelica.SIunits.Angle", "Angle", "rad", "Absolute rotation angle of the flange"},
+                {"Modelica.SIunits.Torque", "Torque", "N.m", "Cut torque in the flange"},
+        };
+        static const char *causalities[] = {"local", "local", "local", "output", "input", "parameter"};
+
+        std::string xml;
+        xml.reserve(numVariables * 260 + 1024);
+        xml += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+               "<fmiModelDescription fmiVersion=\"2.0\" modelName=\"Synthetic\" "
+               "guid=\"{8c4e810f-3df3-4a00-8276-176fa3c9f000}\" generationTool=\"fmi4cpp bench\" "
+               "numberOfEventIndicators=\"0\">\n"
+               "  <CoSimulation modelIdentifier=\"Synthetic\" canHandleVariableCommunicationStepSize=\"true\"/>\n"
+               "  <DefaultExperiment startTime=\"0\" stopTime=\"10\" stepSize=\"0.001\"/>\n"
+               "  <ModelVariables>\n";
+
+        std::string outputs;
+        std::string derivatives;
+        for (size_t i = 0; i < numVariables; i++) {
+
+            // every 50th variable is an alias of the Real before it
+            const bool alias = i % 50 == 1;
+            const size_t vr = alias ? i : i + 1;
+            const std::string name = "system.subsystem" + std::to_string(i / 1000) + ".component" +
+                                     std::to_string(i / 10 % 100) + ".port" + std::to_string(i % 10);
+            const char *causality = causalities[i % 6];
+
+            xml += "    <ScalarVariable name=\"";
+            xml += name;
+            xml += "\" valueReference=\"" + std::to_string(vr) + "\" causality=\"";
+            xml += causality;
+
+            switch (i % 10) {
+                case 7:
+                    xml += "\" variability=\"discrete\" description=\"Number of events\">\n"
+                           "      <Integer start=\"" + std::to_string(i % 5) + "\" min=\"0\"/>\n";
+                    break;
+                case 8:
+                    xml += "\" variability=\"discrete\" description=\"Connector is active\">\n"
+                           "      <Boolean start=\"true\"/>\n";
+                    break;
+                case 9:
+                    xml += "\" variability=\"fixed\" description=\"Medium name\">\n"
+                           "      <String start=\"SimpleLiquidWater\"/>\n";
+                    break;
+                default: {
+                    const auto &q = quantities[i % 6];
+                    xml += "\" variability=\"";
+                    xml += std::string(causality) == "parameter" ? "fixed" : "continuous";
+                    xml += "\" description=\"";
+                    xml += q[3];
+                    xml += "\">\n      <Real declaredType=\"";
+                    xml += q[0];
+                    xml += "\" quantity=\"";
+                    xml += q[1];
+                    xml += "\" unit=\"";
+                    xml += q[2];
+                    xml += "\"";
+                    if (i % 30 == 2 && !alias) {
+                        xml += " derivative=\"" + std::to_string(i) + "\"";
+                        derivatives += "      <Unknown index=\"" + std::to_string(i + 1) + "\" dependencies=\"" +
+                                       std::to_string(i) + "\"/>\n";
+                    }
+                    if (!alias && (std::string(causality) != "local" || i % 3 == 0)) {
+                        xml += " start=\"" + std::to_string(293.15 + i % 100) + "\"";
+                    }
+                    xml += "/>\n";
+                }
+            }
+            xml += "    </ScalarVariable>\n";
+
+            if (std::string(causality) == "output") {
+                const size_t index = i + 1;
+                outputs += "      <Unknown index=\"" + std::to_string(index) + "\" dependencies=\"";
+                for (size_t d = 1; d <= 3 && d < index; d++) {
+                    outputs += (d > 1 ? " " : "") + std::to_string(index - d);
+                }
+                outputs += "\"/>\n";
+            }
+        }
+
+        xml += "  </ModelVariables>\n"
+               "  <ModelStructure>\n"
+               "    <Outputs>\n";
+        xml += outputs;
+        xml += "    </Outputs>\n"
+               "    <Derivatives>\n";
+        xml += derivatives;
+        xml += "    </Derivatives>\n"
+               "    <InitialUnknowns>\n";
+        xml += outputs;
+        xml += "    </InitialUnknowns>\n"
+               "  </ModelStructure>\n"
+               "</fmiModelDescription>\n";
+        return xml;
+    }
+
+}
+
+#endif //FMI4CPP_SYNTHETIC_MODEL_HPP
@@ -0,0 +1,155 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <functional>
+#include <experimental/filesystem>
+
+#include <fmi4cpp/tools/unzipper.hpp>
+
+using namespace std;
+
+namespace fs = std::experimental::filesystem;
+
+namespace {
+
+    // the extraction loop as it was before extraction went parallel, kept as a baseline
+    bool extractContentsBaseline(const string &zip_file, const string &tmp_path) {
+
+        zip *za = zip_open(zip_file.c_str(), 0, nullptr);
+        if (za == nullptr) {
+            return false;
+        }
+
+        struct zip_file *zf;
+        struct zip_stat sb;
+
+        const int bufferSize = 1000;
+        char *contents = (char *) malloc(sizeof(char) * bufferSize);
+        zip_int64_t sum, len;
+        for (int i = 0; i < zip_get_num_entries(za, 0); i++) {
+            if (zip_stat_index(za, i, 0, &sb) == 0) {
+
+                const fs::path newFile = fs::path(tmp_path) / sb.name;
+
+                if (string(sb.name).back() == '/') {
+                    fs::create_directories(newFile);
+                } else {
+                    fs::create_directories(newFile.parent_path());
+                    zf = zip_fopen_index(za, i, 0);
+
+                    ofstream file;
+                    file.open(newFile.string(), ios::out | ios::binary);
+
+                    sum = 0;
+                    while (sum != sb.size) {
+                        len = zip_fread(zf, contents, bufferSize);
+                        if (len <= 0) {
+                            break;
+                        }
+                        file.write(contents, len);
+                        sum += len;
+                    }
+
+                    file.close();
+                    zip_fclose(zf);
+                }
+
+            }
+        }
+        free(contents);
+        zip_close(za);
+
+        return true;
+    }
+
+    zip_uint64_t uncompressedSize(const string &zip_file) {
+        zip_uint64_t size = 0;
+        zip_t *za = zip_open(zip_file.c_str(), ZIP_RDONLY, nullptr);
+        zip_stat_t sb;
+        for (zip_int64_t i = 0; i < zip_get_num_entries(za, 0); i++) {
+            if (zip_stat_index(za, i, 0, &sb) == 0) {
+                size += sb.size;
+            }
+        }
+        zip_discard(za);
+        return size;
+    }
+
+    void run(const string &label, const string &fmuFile, int iterations, const function<bool(const string &)> &extract) {
+
+        const double mb = uncompressedSize(fmuFile) / 1e6;
+        double best = 0;
+        for (int i = 0; i < iterations; i++) {
+            const auto dir = fs::temp_directory_path() / ("fmi4cpp_unzip_bench_" + to_string(i));
+            fs::remove_all(dir);
+            fs::create_directories(dir);
+
+            const auto start = chrono::steady_clock::now();
+            if (!extract(dir.string())) {
+                cerr << label << ": extraction failed!" << endl;
+                return;
+            }
+            const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+            best = max(best, mb / elapsed.count());
+            fs::remove_all(dir);
+        }
+
+        cout << label << ": " << best << " MB/s" << endl;
+    }
+
+}
+
+int main(int argc, char **argv) {
+
+    if (argc < 2) {
+        cout << "usage: unzip_bench <fmu> [iterations]" << endl;
+        return 1;
+    }
+
+    const string fmuFile = argv[1];
+    const int iterations = argc > 2 ? stoi(argv[2]) : 5;
+
+    cout << "Extracting '" << fmuFile << "' (" << uncompressedSize(fmuFile) / 1e6 << " MB uncompressed), best of "
+         << iterations << endl;
+
+    run("baseline (sequential, 1000 byte buffer)", fmuFile, iterations, [&](const string &dir) {
+        return extractContentsBaseline(fmuFile, dir);
+    });
+
+    run("extractContents, 1 thread", fmuFile, iterations, [&](const string &dir) {
+        return extractContents(fmuFile, dir, fmi4cpp::fmi2::ExtractionPolicy::everything, 1);
+    });
+
+    const unsigned int numThreads = max(1u, thread::hardware_concurrency());
+    run("extractContents, " + to_string(numThreads) + " threads", fmuFile, iterations, [&](const string &dir) {
+        return extractContents(fmuFile, dir, fmi4cpp::fmi2::ExtractionPolicy::everything, numThreads);
+    });
+
+    return 0;
+}
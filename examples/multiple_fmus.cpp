@@ -39,9 +39,17 @@ const string fmu_path2 = string(getenv("TEST_FMUs"))
                          "/20sim/4.6.4.8004/ControlledTemperature/ControlledTemperature.fmu";
 
 int main() {
-    
-    Fmu fmu1(fmu_path1);
-    Fmu fmu2(fmu_path2);
+
+    const auto results = loadFmus({fmu_path1, fmu_path2});
+    for (const auto &result : results) {
+        if (!result.ok()) {
+            cerr << "Failed to load '" << result.fmuFile << "': " << result.error << endl;
+            return 1;
+        }
+    }
+
+    const auto &fmu1 = *results[0].fmu;
+    const auto &fmu2 = *results[1].fmu;
     
     const auto slave1 = fmu1.asCoSimulationFmu()->newInstance();
     const auto md1 = slave1->getModelDescription();
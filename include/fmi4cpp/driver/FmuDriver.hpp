@@ -72,9 +72,13 @@ public:
 
         void run(DriverOptions options);
 
+        // timings of the last run, from unzipping the FMU up to instantiating the slave
+        const fmi4cpp::fmi2::LoadReport &loadReport() const;
+
     private:
 
         const std::shared_ptr<fmi4cpp::fmi2::Fmu> fmu_;
+        fmi4cpp::fmi2::LoadReport report_;
 
         void dumpOutput(const std::string &data, const std::string &outputFolder);
 
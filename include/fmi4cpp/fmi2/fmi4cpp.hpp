@@ -30,6 +30,7 @@
 #include "xml/TypedScalarVariable.hpp"
 
 #include "import/Fmu.hpp"
+#include "import/FmuLoader.hpp"
 #include "import/FmuSlave.hpp"
 #include "import/CoSimulationSlave.hpp"
 #include "import/ModelExchangeSlave.hpp"
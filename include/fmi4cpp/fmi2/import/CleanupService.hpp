@@ -0,0 +1,81 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_CLEANUPSERVICE_HPP
+#define FMI4CPP_CLEANUPSERVICE_HPP
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include <experimental/filesystem>
+
+namespace fs = std::experimental::filesystem;
+
+namespace fmi4cpp::fmi2 {
+
+    // Removes temporary FMU directories on a background thread, so that releasing an FMU never blocks on disk IO.
+    // On start-up it also sweeps fmi4cpp-p<pid>-* directories left behind by processes that are no longer running.
+    class CleanupService {
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable workAvailable_;
+        std::condition_variable idle_;
+        std::deque<fs::path> queue_;
+        bool busy_ = false;
+        bool stop_ = false;
+        std::thread reaper_;
+
+        CleanupService();
+
+        void run();
+
+    public:
+        static CleanupService &instance();
+
+        // directories swept for stale extractions: the system temp directory, and /dev/shm on Linux
+        static std::vector<fs::path> sweepDirectories();
+
+        void schedule(const fs::path &path);
+
+        // blocks until every scheduled directory has been removed
+        void flush();
+
+        // removes fmi4cpp-p<pid>-* directories in dir whose owning process is gone, returns the number removed.
+        // Directories modified in the last ten minutes, or whose lock file is held, are left alone.
+        size_t sweepStale(const fs::path &dir);
+
+        CleanupService(const CleanupService &) = delete;
+
+        CleanupService &operator=(const CleanupService &) = delete;
+
+        ~CleanupService();
+
+    };
+
+}
+
+#endif //FMI4CPP_CLEANUPSERVICE_HPP
@@ -0,0 +1,87 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_EXTRACTIONCACHE_HPP
+#define FMI4CPP_EXTRACTIONCACHE_HPP
+
+#include <mutex>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
+#include <experimental/filesystem>
+
+#include "FmuResource.hpp"
+#include "ExtractionPolicy.hpp"
+
+namespace fs = std::experimental::filesystem;
+
+namespace fmi4cpp::fmi2 {
+
+    /**
+     * Persistent cache of extracted FMUs, keyed by the SHA-256 of the .fmu archive.
+     *
+     * Archives extracted with ExtractionPolicy::runtimeOnly are stored as separate entries.
+     * Entries are shared between Fmu objects and between processes using the same cache directory.
+     * Population and eviction are serialized through advisory locks on lock files, which the operating
+     * system releases when their holder dies. Every live FmuResource holds a reference file so that
+     * entries in use are never evicted. Once the total size exceeds maxSize, the least recently used
+     * unreferenced entries are removed.
+     */
+    class ExtractionCache {
+
+    private:
+
+        fs::path cacheDir_;
+        uintmax_t maxSize_;
+
+        std::mutex mutex_;
+        std::unordered_map<std::string, std::string> hashes_;
+
+        std::string hashOf(const std::string &fmuFile);
+
+        void populate(const std::string &fmuFile, const std::string &key, ExtractionPolicy policy);
+
+    public:
+
+        static const uintmax_t DEFAULT_MAX_SIZE;
+
+        static fs::path defaultDirectory();
+
+        explicit ExtractionCache(const fs::path &cacheDir = defaultDirectory(), uintmax_t maxSize = DEFAULT_MAX_SIZE);
+
+        const fs::path &directory() const;
+
+        uintmax_t maxSize() const;
+
+        std::shared_ptr<FmuResource> acquire(const std::string &fmuFile,
+                                             ExtractionPolicy policy = ExtractionPolicy::everything);
+
+        void evict();
+
+    };
+
+}
+
+#endif //FMI4CPP_EXTRACTIONCACHE_HPP
@@ -54,6 +54,7 @@ typedef void *function_ptr;
 #endif
 
 #include "FmuResource.hpp"
+#include "LoadReport.hpp"
 
 namespace fmi4cpp::fmi2 {
 
@@ -105,12 +106,19 @@ namespace fmi4cpp::fmi2 {
 
         fmi2Status lastStatus_;
 
+        LoadReport::duration dlopenTime_ = LoadReport::duration::zero();
+        LoadReport::duration dlsymTime_ = LoadReport::duration::zero();
+
         bool updateStatusAndReturnTrueIfOK(fmi2Status status);
 
     public:
 
         FmiLibrary(const std::string &modelIdentifier, const std::shared_ptr<FmuResource> &resource);
 
+        LoadReport::duration dlopenTime() const;
+
+        LoadReport::duration dlsymTime() const;
+
         fmi2Status getLastStatus() const;
 
         fmi2String getVersion() const;
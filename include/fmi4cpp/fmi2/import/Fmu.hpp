@@ -28,9 +28,13 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <type_traits>
 
 #include "FmuResource.hpp"
+#include "LoadReport.hpp"
+#include "ExtractionCache.hpp"
+#include "ExtractionPolicy.hpp"
 #include "CoSimulationLibrary.hpp"
 #include "ModelExchangeLibrary.hpp"
 #include "ModelExchangeInstance.hpp"
@@ -87,9 +91,22 @@ namespace fmi4cpp::fmi2 {
 
         std::shared_ptr<FmuResource> resource_;
         std::shared_ptr<ModelDescription> modelDescription_;
+        LoadReport report_;
+
+        void openDirectory(const std::string &fmuDir);
+
+        void loadModelDescription();
 
     public:
-        explicit Fmu(const std::string &fmuFile);
+        // fmuFile may also be an already extracted FMU directory, which is used in place and never deleted.
+        // The archive is unzipped on extractionThreads threads (0 = hardware concurrency).
+        explicit Fmu(const std::string &fmuFile, ExtractionPolicy policy = ExtractionPolicy::everything,
+                     unsigned int extractionThreads = 0);
+
+        Fmu(const std::string &fmuFile, ExtractionCache &cache,
+            ExtractionPolicy policy = ExtractionPolicy::everything);
+
+        Fmu(const std::vector<uint8_t> &fmuData, const std::string &fmuName);
 
         const std::string fmuFile_;
         
@@ -99,6 +116,8 @@ namespace fmi4cpp::fmi2 {
 
         std::shared_ptr<ModelDescription> getModelDescription() const override;
 
+        const LoadReport &loadReport() const;
+
         bool supportsModelExchange() const override;
 
         bool supportsCoSimulation() const override;
@@ -116,14 +135,19 @@ namespace fmi4cpp::fmi2 {
         std::shared_ptr<FmuResource> resource_;
         std::shared_ptr<CoSimulationLibrary> lib_;
         std::shared_ptr<CoSimulationModelDescription> modelDescription_;
+        LoadReport report_;
 
     public:
 
         CoSimulationFmu(const std::shared_ptr<FmuResource> &resource,
-                        const std::shared_ptr<CoSimulationModelDescription> &md);
+                        const std::shared_ptr<CoSimulationModelDescription> &md,
+                        const LoadReport &report = LoadReport());
 
         std::shared_ptr<CoSimulationModelDescription> getModelDescription() const override;
 
+        // extends the report of the Fmu this was created from with the library and instantiation timings
+        const LoadReport &loadReport() const;
+
         std::unique_ptr<FmuSlave> newInstance(bool visible = false, bool loggingOn = false);
 
     };
@@ -135,14 +159,18 @@ namespace fmi4cpp::fmi2 {
         std::shared_ptr<FmuResource> resource_;
         std::shared_ptr<ModelExchangeLibrary> lib_;
         std::shared_ptr<ModelExchangeModelDescription> modelDescription_;
+        LoadReport report_;
 
     public:
 
         ModelExchangeFmu(const std::shared_ptr<FmuResource> &resource,
-                         const std::shared_ptr<ModelExchangeModelDescription> &md);
+                         const std::shared_ptr<ModelExchangeModelDescription> &md,
+                         const LoadReport &report = LoadReport());
 
         std::shared_ptr<ModelExchangeModelDescription> getModelDescription() const override;
 
+        const LoadReport &loadReport() const;
+
         std::unique_ptr<ModelExchangeInstance> newInstance(bool visible = false, bool loggingOn = false);
 
         std::unique_ptr<ModelExchangeSlave>
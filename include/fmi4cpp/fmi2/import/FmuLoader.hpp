@@ -0,0 +1,62 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_FMULOADER_HPP
+#define FMI4CPP_FMULOADER_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <future>
+
+#include "Fmu.hpp"
+
+namespace fmi4cpp::fmi2 {
+
+    struct FmuLoadResult {
+
+        std::string fmuFile;
+        std::shared_ptr<Fmu> fmu;
+        // empty when the FMU was loaded successfully
+        std::string error;
+
+        bool ok() const {
+            return fmu != nullptr;
+        }
+
+    };
+
+    std::future<std::shared_ptr<Fmu>> loadFmuAsync(const std::string &fmuFile,
+                                                   ExtractionPolicy policy = ExtractionPolicy::everything);
+
+    // Extracts and parses the given FMUs on a pool of numThreads threads (0 = hardware concurrency).
+    // With fewer FMUs than threads, the remaining threads help unzipping, so at most numThreads run at once.
+    // A failing FMU is reported in its result without aborting the rest of the batch.
+    // Results are returned in the same order as fmuFiles.
+    std::vector<FmuLoadResult> loadFmus(const std::vector<std::string> &fmuFiles, unsigned int numThreads = 0,
+                                        ExtractionPolicy policy = ExtractionPolicy::everything);
+
+}
+
+#endif //FMI4CPP_FMULOADER_HPP
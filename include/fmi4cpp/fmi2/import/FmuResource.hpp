@@ -25,6 +25,7 @@
 #ifndef FMI4CPP_TEMPORALFOLDER_HPP
 #define FMI4CPP_TEMPORALFOLDER_HPP
 
+#include <memory>
 #include <experimental/filesystem>
 
 namespace fs = std::experimental::filesystem;
@@ -35,17 +36,26 @@ class FmuResource {
 
 private:
     fs::path path_;
+    bool deleteOnClose_;
+    // lock on a file in a directory this resource deletes, tells CleanupService::sweepStale that it is in use
+    std::shared_ptr<void> ownerLock_;
 
     public:
-        explicit FmuResource(fs::path &path);
+        // with deleteOnClose, path must exist
+        explicit FmuResource(const fs::path &path, bool deleteOnClose = true);
+
+        const fs::path &path() const;
 
         const std::string getResourcePath() const;
 
         const std::string getModelDescriptionPath() const;
 
-        const std::string getAbsoluteLibraryPath(const std::string &modelIdentifier) const;
+        // true if the directory is an ExtractionCache entry, which carries a pre-parsed model description
+        virtual bool hasModelDescriptionCache() const;
+
+        virtual const std::string getAbsoluteLibraryPath(const std::string &modelIdentifier) const;
 
-        ~FmuResource();
+        virtual ~FmuResource();
 
     };
 
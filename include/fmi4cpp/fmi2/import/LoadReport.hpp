@@ -0,0 +1,62 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_LOADREPORT_HPP
+#define FMI4CPP_LOADREPORT_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+
+namespace fmi4cpp::fmi2 {
+
+    struct LoadReport {
+
+        typedef std::chrono::steady_clock::duration duration;
+
+        duration unzip = duration::zero();
+        duration parse = duration::zero();
+        duration dlopen = duration::zero();
+        duration dlsym = duration::zero();
+        // time spent in the most recent fmi2Instantiate call
+        duration instantiate = duration::zero();
+
+        uintmax_t bytesExtracted = 0;
+        size_t numVariables = 0;
+        // true if the model description was read from its binary cache
+        bool parseCached = false;
+        // true if the most recent instance reused the library loaded for an earlier one,
+        // dlopen and dlsym are zero then
+        bool libraryReused = false;
+
+        duration total() const;
+
+    };
+
+    std::ostream &operator<<(std::ostream &os, const LoadReport &report);
+
+}
+
+#endif //FMI4CPP_LOADREPORT_HPP
@@ -0,0 +1,137 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_DEPENDENCYGRAPH_HPP
+#define FMI4CPP_DEPENDENCYGRAPH_HPP
+
+#include <vector>
+#include <optional>
+
+#include "enums.hpp"
+#include "ModelStructure.hpp"
+
+namespace fmi4cpp::fmi2 {
+
+    // The edges of a single row or column of a DependencyGraph, sorted by variable index.
+    class DependencyRange {
+
+    private:
+        const unsigned int *indices_;
+        const DependencyKind *kinds_;
+        size_t size_;
+
+    public:
+
+        DependencyRange(const unsigned int *indices, const DependencyKind *kinds, size_t size)
+                : indices_(indices), kinds_(kinds), size_(size) {}
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        unsigned int operator[](size_t i) const {
+            return indices_[i];
+        }
+
+        DependencyKind kind(size_t i) const {
+            return kinds_[i];
+        }
+
+        const unsigned int *begin() const {
+            return indices_;
+        }
+
+        const unsigned int *end() const {
+            return indices_ + size_;
+        }
+
+    };
+
+    // Compressed sparse row form of one ModelStructure section, together with its transpose.
+    // Rows and columns are the 1-based ScalarVariable indices used by the ModelStructure.
+    // An Unknown without a dependencies attribute depends on all knowns. It contributes no edges, but is
+    // reported by dependsOnAllKnowns() and treated as dependent on every variable by dependsOn().
+    class DependencyGraph {
+
+    private:
+
+        std::vector<unsigned int> unknowns_;
+        // sorted
+        std::vector<unsigned int> allKnowns_;
+
+        std::vector<size_t> rowOffsets_;
+        std::vector<unsigned int> columns_;
+        std::vector<DependencyKind> kinds_;
+
+        std::vector<size_t> columnOffsets_;
+        std::vector<unsigned int> rows_;
+        std::vector<DependencyKind> transposedKinds_;
+
+        static DependencyRange range(const std::vector<size_t> &offsets, const std::vector<unsigned int> &indices,
+                                     const std::vector<DependencyKind> &kinds, size_t i);
+
+    public:
+
+        DependencyGraph() = default;
+
+        explicit DependencyGraph(const std::vector<Unknown> &unknowns);
+
+        // indices of the unknowns, in declaration order
+        const std::vector<unsigned int> &unknowns() const;
+
+        size_t numberOfEdges() const;
+
+        // the variables 'unknown' depends on
+        DependencyRange dependencies(unsigned int unknown) const;
+
+        // the unknowns that depend on 'known', not including those that depend on all knowns
+        DependencyRange dependents(unsigned int known) const;
+
+        bool dependsOnAllKnowns(unsigned int unknown) const;
+
+        // indices of the unknowns without a dependencies attribute, in ascending order
+        const std::vector<unsigned int> &unknownsDependingOnAllKnowns() const;
+
+        // DependencyKind::dependent for any 'known' if the unknown depends on all knowns
+        std::optional<DependencyKind> dependsOn(unsigned int unknown, unsigned int known) const;
+
+    };
+
+    struct DependencyGraphs {
+
+        DependencyGraph outputs;
+        DependencyGraph derivatives;
+        DependencyGraph initialUnknowns;
+
+        explicit DependencyGraphs(const ModelStructure &structure);
+
+    };
+
+}
+
+#endif //FMI4CPP_DEPENDENCYGRAPH_HPP
@@ -28,10 +28,15 @@
 #include <memory>
 #include <string>
 #include <optional>
+#include <functional>
+#include <string_view>
 
 #include "ModelStructure.hpp"
+#include "DependencyGraph.hpp"
 #include "ModelVariables.hpp"
+#include "VariableCatalogue.hpp"
 #include "DefaultExperiment.hpp"
+#include "TypeDefinitions.hpp"
 #include "FmuAttributes.hpp"
 
 namespace fmi4cpp::fmi2 {
@@ -53,11 +58,14 @@ namespace fmi4cpp::fmi2 {
 
         size_t numberOfEventIndicators_;
 
-        std::shared_ptr<ModelVariables> modelVariables_;
-        std::shared_ptr<ModelStructure> modelStructure_;
+        // shared between copies, so that the variables and the structure are parsed at most once
+        struct LazyParts;
+        std::shared_ptr<LazyParts> lazy_;
 
         std::optional<DefaultExperiment> defaultExperiment_;
 
+        std::shared_ptr<const TypeDefinitions> typeDefinitions_;
+
     public:
         ModelDescriptionBase(const std::string &guid,
                              const std::string &fmiVersion,
@@ -73,7 +81,27 @@ namespace fmi4cpp::fmi2 {
                              const size_t numberOfEventIndicators,
                              const std::shared_ptr<ModelVariables> &modelVariables,
                              const std::shared_ptr<ModelStructure> &modelStructure,
-                             const std::optional<DefaultExperiment> &defaultExperiment);
+                             const std::optional<DefaultExperiment> &defaultExperiment,
+                             const std::shared_ptr<const TypeDefinitions> &typeDefinitions = nullptr);
+
+        // modelVariables() and modelStructure() invoke the loaders on first access, exactly once
+        ModelDescriptionBase(const std::string &guid,
+                             const std::string &fmiVersion,
+                             const std::string &modelName,
+                             const std::optional<std::string> &description,
+                             const std::optional<std::string> &version,
+                             const std::optional<std::string> &author,
+                             const std::optional<std::string> &license,
+                             const std::optional<std::string> &copyright,
+                             const std::optional<std::string> &generationTool,
+                             const std::optional<std::string> &generationDateAndTime,
+                             const std::optional<std::string> &variableNamingConvention,
+                             const size_t numberOfEventIndicators,
+                             const size_t numberOfVariables,
+                             const std::function<std::shared_ptr<ModelVariables>()> &modelVariablesLoader,
+                             const std::function<std::shared_ptr<ModelStructure>()> &modelStructureLoader,
+                             const std::optional<DefaultExperiment> &defaultExperiment,
+                             const std::shared_ptr<const TypeDefinitions> &typeDefinitions = nullptr);
 
         std::string guid() const;
 
@@ -101,15 +129,28 @@ namespace fmi4cpp::fmi2 {
 
         size_t numberOfContinuousStates() const;
 
+        // number of ScalarVariables, available without parsing them
+        size_t numberOfVariables() const;
+
         const std::shared_ptr<ModelVariables> &modelVariables() const;
 
+        // columnar copy of the model variables, built on first access
+        const std::shared_ptr<const VariableCatalogue> &variableCatalogue() const;
+
         const std::shared_ptr<ModelStructure> &modelStructure() const;
 
+        // CSR form of the model structure, built on first access
+        const std::shared_ptr<const DependencyGraphs> &dependencyGraphs() const;
+
         const std::optional<DefaultExperiment> defaultExperiment() const;
 
-        fmi2ValueReference getValueReference(const std::string &name) const;
+        const std::shared_ptr<const TypeDefinitions> &typeDefinitions() const;
+
+        const std::shared_ptr<const UnitDefinitions> &unitDefinitions() const;
+
+        fmi2ValueReference getValueReference(std::string_view name) const;
         
-        const ScalarVariable &getVariableByName(const std::string &name) const;
+        const ScalarVariable &getVariableByName(std::string_view name) const;
 
     };
 
@@ -128,6 +169,8 @@ namespace fmi4cpp::fmi2 {
                          const std::optional<CoSimulationAttributes> &coSimulation,
                          const std::optional<ModelExchangeAttributes> &modelExchange);
 
+        static std::unique_ptr<ModelDescription> fromArchive(const std::string &fmuFile);
+
         bool supportsCoSimulation() const;
 
         bool supportsModelExchange() const;
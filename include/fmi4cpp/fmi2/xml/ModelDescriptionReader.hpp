@@ -0,0 +1,60 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_MODELDESCRIPTIONREADER_HPP
+#define FMI4CPP_MODELDESCRIPTIONREADER_HPP
+
+#include <memory>
+#include <string>
+
+#include "ModelDescription.hpp"
+
+namespace fmi4cpp::fmi2 {
+
+    // Parses a modelDescription.xml held in memory with the streaming parser, throws std::runtime_error if
+    // it is malformed. ModelVariables sections longer than 'variablesPerChunk' are parsed in parallel chunks;
+    // a 'variablesPerChunk' of zero throws std::invalid_argument.
+    std::unique_ptr<ModelDescription> readModelDescriptionXml(const std::shared_ptr<const std::string> &xml);
+
+    std::unique_ptr<ModelDescription> readModelDescriptionXml(const std::shared_ptr<const std::string> &xml,
+                                                              size_t variablesPerChunk);
+
+    // The same through boost::property_tree, which builds a DOM first. Slower, but independent of the streaming parser.
+    std::unique_ptr<ModelDescription> readModelDescriptionXmlPtree(const std::string &xml);
+
+    // The binary form that loads of FMUs in an ExtractionCache keep next to modelDescription.xml.
+    // 'xmlHash' identifies the XML it was made from; reading returns nullptr if it does not match or the file
+    // cannot be read. Sections found to be corrupt on first access are parsed from 'xmlFile' instead,
+    // or throw std::runtime_error when it is empty.
+
+    bool writeModelDescriptionCacheFile(const ModelDescription &md, const std::string &xmlHash,
+                                        const std::string &cacheFile);
+
+    std::unique_ptr<ModelDescription> readModelDescriptionCacheFile(const std::string &cacheFile,
+                                                                    const std::string &xmlHash,
+                                                                    const std::string &xmlFile = "");
+
+}
+
+#endif //FMI4CPP_MODELDESCRIPTIONREADER_HPP
@@ -44,10 +44,10 @@ namespace fmi4cpp::fmi2 {
     public:
 
         Unknown(unsigned int index, const std::optional<std::string> &dependenciesKind,
-                const std::optional<std::vector<unsigned int>> &dependencies);
+                std::optional<std::vector<unsigned int>> dependencies);
 
-        const size_t index();
-        const std::optional<std::string> dependenciesKind();
+        const size_t index() const;
+        const std::optional<std::string> dependenciesKind() const;
         const std::optional<std::vector<unsigned int >> &dependencies() const;
 
     };
@@ -64,8 +64,8 @@ namespace fmi4cpp::fmi2 {
 
         ModelStructure() = default;
 
-        ModelStructure(const std::vector<Unknown> &outputs_, const std::vector<Unknown> &derivatives_,
-                       const std::vector<Unknown> &initialUnknowns_);
+        ModelStructure(std::vector<Unknown> outputs_, std::vector<Unknown> derivatives_,
+                       std::vector<Unknown> initialUnknowns_);
 
         const std::vector<Unknown> &outputs() const;
 
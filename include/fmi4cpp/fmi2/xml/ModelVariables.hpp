@@ -28,16 +28,125 @@
 
 #include <vector>
 #include <memory>
+#include <iterator>
+#include <string_view>
 
 #include <fmi4cpp/fmi2/xml/ScalarVariable.hpp>
+#include <fmi4cpp/fmi2/xml/NameIndex.hpp>
+#include <fmi4cpp/fmi2/xml/NameTree.hpp>
+#include <fmi4cpp/fmi2/xml/ValueReferenceIndex.hpp>
+#include <fmi4cpp/fmi2/xml/StringPool.hpp>
+#include <fmi4cpp/fmi2/xml/TypeDefinitions.hpp>
 
 namespace fmi4cpp::fmi2 {
 
+    // The variables matching a predicate, found while iterating. Nothing is copied or allocated.
+    template<typename Predicate>
+    class FilteredVariables {
+
+    private:
+        const ScalarVariable *begin_;
+        const ScalarVariable *end_;
+        Predicate predicate_;
+
+    public:
+
+        class iterator {
+
+        private:
+            const ScalarVariable *current_;
+            const ScalarVariable *end_;
+            Predicate predicate_;
+
+            void skip() {
+                while (current_ != end_ && !predicate_(*current_)) {
+                    ++current_;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ScalarVariable;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const ScalarVariable *;
+            using reference = const ScalarVariable &;
+
+            iterator(const ScalarVariable *current, const ScalarVariable *end, const Predicate &predicate)
+                    : current_(current), end_(end), predicate_(predicate) {
+                skip();
+            }
+
+            reference operator*() const {
+                return *current_;
+            }
+
+            pointer operator->() const {
+                return current_;
+            }
+
+            iterator &operator++() {
+                ++current_;
+                skip();
+                return *this;
+            }
+
+            iterator operator++(int) {
+                iterator it = *this;
+                ++*this;
+                return it;
+            }
+
+            bool operator==(const iterator &other) const {
+                return current_ == other.current_;
+            }
+
+            bool operator!=(const iterator &other) const {
+                return current_ != other.current_;
+            }
+
+        };
+
+        FilteredVariables(const ScalarVariable *begin, const ScalarVariable *end, Predicate predicate)
+                : begin_(begin), end_(end), predicate_(std::move(predicate)) {}
+
+        iterator begin() const {
+            return iterator(begin_, end_, predicate_);
+        }
+
+        iterator end() const {
+            return iterator(end_, end_, predicate_);
+        }
+
+        // walks the whole range
+        size_t count() const {
+            return static_cast<size_t>(std::distance(begin(), end()));
+        }
+
+    };
+
+    struct HasCausality {
+
+        Causality causality;
+
+        bool operator()(const ScalarVariable &variable) const {
+            return variable.causality() == causality;
+        }
+
+    };
+
     class ModelVariables {
 
     private:
 
         std::vector<ScalarVariable> variables_;
+        std::shared_ptr<const StringPool> strings_;
+        std::shared_ptr<const TypeDefinitions> types_;
+        NameIndex names_;
+        ValueReferenceIndex valueReferences_;
+
+        // built on the first selection, accessed through std::atomic_load/atomic_compare_exchange_strong.
+        // Copies start without one.
+        mutable std::shared_ptr<const NameTree> nameTree_;
 
     public:
 
@@ -45,17 +154,51 @@ namespace fmi4cpp::fmi2 {
 
         explicit ModelVariables(const std::vector<ScalarVariable> &variables);
 
+        // the variables refer to strings in the pool and to the type definitions
+        ModelVariables(std::vector<ScalarVariable> &&variables, const std::shared_ptr<const StringPool> &strings,
+                       const std::shared_ptr<const TypeDefinitions> &types = nullptr);
+
+        ModelVariables(const ModelVariables &other);
+        ModelVariables(ModelVariables &&other) = default;
+
+        ModelVariables &operator=(const ModelVariables &other);
+        ModelVariables &operator=(ModelVariables &&other) = default;
+
         size_t size() const;
+
+        const std::shared_ptr<const StringPool> &stringPool() const;
         
-        const std::vector<ScalarVariable> variables() const;
+        const std::vector<ScalarVariable> &variables() const;
 
         const ScalarVariable &operator[](size_t index) const;
-        const ScalarVariable &getByName(const std::string &name) const;
+        const ScalarVariable &getByName(std::string_view name) const;
+        const ScalarVariable &getByValueReference(BaseType type, fmi2ValueReference vr) const;
+
+        // all variables of the base type sharing the value reference, empty if there are none
+        AliasGroup getAliasGroup(BaseType type, fmi2ValueReference vr) const;
+
+        // first variable with the value reference, of any base type
         const ScalarVariable &getByValueReference(fmi2ValueReference vr) const;
 
         void getByValueReference(fmi2ValueReference vr, std::vector<ScalarVariable> &store) const;
         void getByCausality(Causality causality, std::vector<ScalarVariable> &store) const;
 
+        const NameTree &nameTree() const;
+
+        // positions of the variables whose structured name matches 'pattern', e.g. "controller.*.gain",
+        // "a.**" or "x[2:4]", in declaration order. See NameTree for the syntax.
+        std::vector<uint32_t> select(std::string_view pattern) const;
+
+        // lazily filtered ranges over the stored variables, valid as long as this ModelVariables
+
+        FilteredVariables<HasCausality> getByCausality(Causality causality) const;
+
+        template<typename Predicate>
+        FilteredVariables<Predicate> filter(Predicate predicate) const {
+            const auto data = variables_.data();
+            return FilteredVariables<Predicate>(data, data + variables_.size(), std::move(predicate));
+        }
+
         std::vector<ScalarVariable>::iterator begin();
         std::vector<ScalarVariable>::iterator end();
 
@@ -0,0 +1,63 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_NAMEINDEX_HPP
+#define FMI4CPP_NAMEINDEX_HPP
+
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <fmi4cpp/fmi2/xml/ScalarVariable.hpp>
+
+namespace fmi4cpp::fmi2 {
+
+    // Open-addressing (linear probing) hash table from variable name to position. The low bits of the hash
+    // pick the slot, each slot keeps the high 32 bits as a tag, so a probe only compares names when those match.
+    class NameIndex {
+
+    private:
+
+        struct Slot {
+            uint32_t tag;
+            uint32_t position; // position + 1, 0 marks an empty slot
+        };
+
+        std::vector<Slot> slots_;
+
+    public:
+
+        NameIndex() = default;
+
+        explicit NameIndex(const std::vector<ScalarVariable> &variables);
+
+        // position of the first variable named 'name', 'variables' must be the ones the index was built from
+        std::optional<size_t> find(std::string_view name, const std::vector<ScalarVariable> &variables) const;
+
+    };
+
+}
+
+#endif //FMI4CPP_NAMEINDEX_HPP
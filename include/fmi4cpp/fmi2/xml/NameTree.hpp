@@ -0,0 +1,80 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_NAMETREE_HPP
+#define FMI4CPP_NAMETREE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+#include <fmi4cpp/fmi2/xml/ScalarVariable.hpp>
+
+namespace fmi4cpp::fmi2 {
+
+    // Splits a structured name into its components: 'a.b[3,1].c' gives a, b, [3,1] and c.
+    // Dots inside quoted names and inside parentheses, as in der(a.b), do not split.
+    void splitName(std::string_view name, std::vector<std::string_view> &components);
+
+    // Prefix tree over the components of the variable names, see splitName. The children of a node are sorted,
+    // so a selection only visits the part of the tree its pattern can match.
+    //
+    // A pattern is split like a name, and each of its components matches one component of the name:
+    //   gain     the component itself
+    //   *, k?    a glob within one name component
+    //   **       any number of components, a.** selects everything below a
+    //   [2:4,*]  array indices, each one a number, an inclusive range ('2:' and ':4' are open) or '*'
+    class NameTree {
+
+    private:
+
+        struct Node {
+            std::string_view component;
+            uint32_t firstChild;
+            uint32_t numChildren;
+            uint32_t position; // position + 1 of the variable with this name, 0 if there is none
+        };
+
+        // nodes_[0] is the root, the children of every node are stored next to each other
+        std::vector<Node> nodes_;
+
+        void select(uint32_t node, const std::vector<std::string_view> &pattern, size_t next,
+                    std::vector<uint32_t> &positions) const;
+
+    public:
+
+        NameTree();
+
+        explicit NameTree(const std::vector<ScalarVariable> &variables);
+
+        size_t numberOfNodes() const;
+
+        // positions of the variables matching 'pattern', in declaration order
+        std::vector<uint32_t> select(std::string_view pattern) const;
+
+    };
+
+}
+
+#endif //FMI4CPP_NAMETREE_HPP
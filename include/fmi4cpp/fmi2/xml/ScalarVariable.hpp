@@ -25,10 +25,14 @@
 #ifndef FMI4CPP_SCALARVARIABLE_HPP
 #define FMI4CPP_SCALARVARIABLE_HPP
 
+#include <memory>
+#include <variant>
 #include <optional>
+#include <string_view>
 
 #include "enums.hpp"
 #include "../fmi2Functions.h"
+#include "StringPool.hpp"
 #include "ScalarVariableAttribute.hpp"
 
 namespace fmi4cpp::fmi2 {
@@ -43,6 +47,20 @@ namespace fmi4cpp::fmi2 {
 
     class EnumerationVariable;
 
+    class IntegerVariableView;
+
+    class RealVariableView;
+
+    class StringVariableView;
+
+    class BooleanVariableView;
+
+    class EnumerationVariableView;
+
+    class ModelVariables;
+
+    class TypeDefinitions;
+
     const std::string INTEGER_TYPE = "Integer";
     const std::string REAL_TYPE = "Real";
     const std::string STRING_TYPE = "String";
@@ -51,9 +69,15 @@ namespace fmi4cpp::fmi2 {
 
     class ScalarVariableBase {
 
+    friend class ModelVariables;
+
     private:
-        std::string name_;
-        std::string description_;
+        // views into the StringPool of the owning ModelVariables, which copies keep alive
+        std::string_view name_;
+        std::string_view description_;
+        std::shared_ptr<const StringPool> strings_;
+        // the declared types and units the attributes point into, likewise kept alive by copies
+        std::shared_ptr<const TypeDefinitions> types_;
 
         fmi2ValueReference valueReference_;
 
@@ -65,14 +89,14 @@ namespace fmi4cpp::fmi2 {
 
     public:
 
-        ScalarVariableBase(const std::string &name, const std::string &description,
+        ScalarVariableBase(std::string_view name, std::string_view description,
                            fmi2ValueReference valueReference, bool canHandleMultipleSetPerTimelnstant,
                            Causality causality, Variability variability,
                            Initial initial);
 
-        std::string name() const;
+        std::string_view name() const;
 
-        std::string description() const;
+        std::string_view description() const;
 
         fmi2ValueReference valueReference() const;
 
@@ -89,11 +113,8 @@ namespace fmi4cpp::fmi2 {
     class ScalarVariable : public ScalarVariableBase {
 
     private:
-        std::optional<IntegerAttribute> integer_;
-        std::optional<RealAttribute> real_;
-        std::optional<StringAttribute> string_;
-        std::optional<BooleanAttribute> boolean_;
-        std::optional<EnumerationAttribute> enumeration_;
+        // exactly one type per variable, the alternatives are in VariableType order
+        std::variant<IntegerAttribute, RealAttribute, StringAttribute, BooleanAttribute, EnumerationAttribute> attribute_;
 
     public:
 
@@ -114,6 +135,10 @@ namespace fmi4cpp::fmi2 {
 
         std::string typeName() const;
 
+        VariableType type() const;
+
+        BaseType baseType() const;
+
         bool isInteger() const;
 
         bool isReal() const;
@@ -134,6 +159,18 @@ namespace fmi4cpp::fmi2 {
 
         const EnumerationVariable asEnumeration() const;
 
+        // like the asX() functions, but referring to this variable instead of copying it
+
+        IntegerVariableView asIntegerView() const;
+
+        RealVariableView asRealView() const;
+
+        StringVariableView asStringView() const;
+
+        BooleanVariableView asBooleanView() const;
+
+        EnumerationVariableView asEnumerationView() const;
+
     };
 
 }
@@ -28,20 +28,26 @@
 #include <string>
 #include <ostream>
 #include <optional>
+#include <string_view>
 
 namespace fmi4cpp::fmi2 {
 
+    class Unit;
+    struct SimpleType;
+
     template<typename T>
     struct ScalarVariableAttribute {
 
         std::optional<T> start;
-        std::optional<std::string> declaredType;
+        std::optional<std::string_view> declaredType;
+        // resolved from declaredType, nullptr if the type is not defined
+        const SimpleType *type = nullptr;
 
         ScalarVariableAttribute() {}
 
         explicit ScalarVariableAttribute(const std::optional<T> &start) : start(start) {}
 
-        ScalarVariableAttribute(const std::optional<T> &start, const std::optional<std::string> &declaredType)
+        ScalarVariableAttribute(const std::optional<T> &start, const std::optional<std::string_view> &declaredType)
                 : start(start), declaredType(declaredType) {}
 
     };
@@ -52,13 +58,13 @@ namespace fmi4cpp::fmi2 {
 
         std::optional<T> min;
         std::optional<T> max;
-        std::optional<std::string> quantity;
+        std::optional<std::string_view> quantity;
 
         explicit BoundedScalarVariableAttribute(const ScalarVariableAttribute<T> &attributes)
                 : ScalarVariableAttribute<T>(attributes) {}
 
         BoundedScalarVariableAttribute(const ScalarVariableAttribute<T> &attributes, const std::optional<T> &min,
-                                       const std::optional<T> &max, const std::optional<std::string> &quantity)
+                                       const std::optional<T> &max, const std::optional<std::string_view> &quantity)
                 : min(min), max(max), quantity(quantity) {}
 
     };
@@ -78,8 +84,10 @@ namespace fmi4cpp::fmi2 {
         std::optional<double> nominal;
         std::optional<unsigned int> derivative;
 
-        std::optional<std::string> unit;
-        std::optional<std::string> displayUnit;
+        std::optional<std::string_view> unit;
+        std::optional<std::string_view> displayUnit;
+        // resolved from the unit of the variable or of its declared type
+        const Unit *unitDefinition = nullptr;
 
         explicit RealAttribute(const BoundedScalarVariableAttribute<double> &attributes);
 
@@ -0,0 +1,191 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_SCALARVARIABLEVIEW_HPP
+#define FMI4CPP_SCALARVARIABLEVIEW_HPP
+
+#include "ScalarVariable.hpp"
+#include "TypeDefinitions.hpp"
+
+namespace fmi4cpp::fmi2 {
+
+    // Non-owning counterparts of the typed variables. A view is two pointers into the ModelVariables
+    // it was taken from, so it is cheap to pass by value but must not outlive the model description.
+    template<typename T, typename U>
+    class TypedScalarVariableView {
+
+    protected:
+        const ScalarVariable *variable_;
+        const U *attribute_;
+
+    public:
+
+        TypedScalarVariableView(const ScalarVariable &variable, const U &attribute)
+                : variable_(&variable), attribute_(&attribute) {}
+
+        const ScalarVariable &variable() const {
+            return *variable_;
+        }
+
+        std::string_view name() const {
+            return variable_->name();
+        }
+
+        std::string_view description() const {
+            return variable_->description();
+        }
+
+        fmi2ValueReference valueReference() const {
+            return variable_->valueReference();
+        }
+
+        Causality causality() const {
+            return variable_->causality();
+        }
+
+        Variability variability() const {
+            return variable_->variability();
+        }
+
+        Initial initial() const {
+            return variable_->initial();
+        }
+
+        bool canHandleMultipleSetPerTimelnstant() const {
+            return variable_->canHandleMultipleSetPerTimelnstant();
+        }
+
+        const std::optional<T> &start() const {
+            return attribute_->start;
+        }
+
+        std::optional<std::string_view> declaredType() const {
+            return attribute_->declaredType;
+        }
+
+        const SimpleType *typeDefinition() const {
+            return attribute_->type;
+        }
+
+        const U &attribute() const {
+            return *attribute_;
+        }
+
+    };
+
+    template<typename T, typename U>
+    class BoundedScalarVariableView : public TypedScalarVariableView<T, U> {
+
+    public:
+
+        BoundedScalarVariableView(const ScalarVariable &variable, const U &attribute)
+                : TypedScalarVariableView<T, U>(variable, attribute) {}
+
+        // min, max and quantity fall back to the declared type
+
+        std::optional<T> min() const {
+            if (this->attribute_->min || !this->attribute_->type) {
+                return this->attribute_->min;
+            }
+            return this->attribute_->type->template min<T>();
+        }
+
+        std::optional<T> max() const {
+            if (this->attribute_->max || !this->attribute_->type) {
+                return this->attribute_->max;
+            }
+            return this->attribute_->type->template max<T>();
+        }
+
+        std::optional<std::string_view> quantity() const {
+            if (this->attribute_->quantity || !this->attribute_->type) {
+                return this->attribute_->quantity;
+            }
+            return this->attribute_->type->quantity();
+        }
+
+    };
+
+    class IntegerVariableView : public BoundedScalarVariableView<int, IntegerAttribute> {
+
+    public:
+        IntegerVariableView(const ScalarVariable &variable, const IntegerAttribute &attribute)
+                : BoundedScalarVariableView(variable, attribute) {}
+
+    };
+
+    class RealVariableView : public BoundedScalarVariableView<double, RealAttribute> {
+
+    public:
+
+        RealVariableView(const ScalarVariable &variable, const RealAttribute &attribute)
+                : BoundedScalarVariableView(variable, attribute) {}
+
+        bool reinit() const;
+
+        bool unbounded() const;
+
+        bool relativeQuantity() const;
+
+        std::optional<double> nominal() const;
+
+        std::optional<size_t> derivative() const;
+
+        std::optional<std::string_view> unit() const;
+
+        std::optional<std::string_view> displayUnit() const;
+
+        const Unit *unitDefinition() const;
+
+        const DisplayUnit *displayUnitDefinition() const;
+
+    };
+
+    class StringVariableView : public TypedScalarVariableView<std::string, StringAttribute> {
+
+    public:
+        StringVariableView(const ScalarVariable &variable, const StringAttribute &attribute)
+                : TypedScalarVariableView(variable, attribute) {}
+
+    };
+
+    class BooleanVariableView : public TypedScalarVariableView<bool, BooleanAttribute> {
+
+    public:
+        BooleanVariableView(const ScalarVariable &variable, const BooleanAttribute &attribute)
+                : TypedScalarVariableView(variable, attribute) {}
+
+    };
+
+    class EnumerationVariableView : public TypedScalarVariableView<int, EnumerationAttribute> {
+
+    public:
+        EnumerationVariableView(const ScalarVariable &variable, const EnumerationAttribute &attribute)
+                : TypedScalarVariableView(variable, attribute) {}
+
+    };
+
+}
+
+#endif //FMI4CPP_SCALARVARIABLEVIEW_HPP
@@ -0,0 +1,74 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_STRINGPOOL_HPP
+#define FMI4CPP_STRINGPOOL_HPP
+
+#include <memory>
+#include <vector>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+
+namespace fmi4cpp::fmi2 {
+
+    // Deduplicated storage for the names, descriptions, units etc. of a set of ScalarVariables.
+    // The views returned by intern() remain valid for the lifetime of the pool.
+    class StringPool {
+
+    private:
+        std::vector<std::unique_ptr<char[]>> blocks_;
+        char *next_ = nullptr;
+        size_t available_ = 0;
+        size_t bytes_ = 0;
+
+        std::unordered_set<std::string_view> index_;
+
+    public:
+
+        StringPool() = default;
+
+        StringPool(const StringPool &) = delete;
+        StringPool &operator=(const StringPool &) = delete;
+
+        std::string_view intern(std::string_view str);
+
+        std::optional<std::string_view> intern(const std::optional<std::string_view> &str);
+
+        // takes ownership of the storage of another pool, views into it stay valid.
+        // Strings already present in both pools are not deduplicated.
+        void merge(StringPool &&other);
+
+        // releases the lookup index once the pool is complete.
+        // Strings interned afterwards are no longer deduplicated against earlier ones.
+        void shrinkToFit();
+
+        // number of characters stored
+        size_t bytes() const;
+
+    };
+
+}
+
+#endif //FMI4CPP_STRINGPOOL_HPP
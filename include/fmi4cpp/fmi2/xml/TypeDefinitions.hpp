@@ -0,0 +1,145 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_TYPEDEFINITIONS_HPP
+#define FMI4CPP_TYPEDEFINITIONS_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include "UnitDefinitions.hpp"
+
+namespace fmi4cpp::fmi2 {
+
+    struct RealType {
+
+        std::optional<std::string> quantity;
+        std::optional<std::string> unit;
+        std::optional<std::string> displayUnit;
+        bool relativeQuantity = false;
+        std::optional<double> min;
+        std::optional<double> max;
+        std::optional<double> nominal;
+        bool unbounded = false;
+
+        // resolved from unit, nullptr if the unit is not defined
+        const Unit *unitDefinition = nullptr;
+
+    };
+
+    struct IntegerType {
+
+        std::optional<std::string> quantity;
+        std::optional<int> min;
+        std::optional<int> max;
+
+    };
+
+    struct EnumerationItem {
+
+        std::string name;
+        int value;
+        std::optional<std::string> description;
+
+    };
+
+    struct EnumerationType {
+
+        std::optional<std::string> quantity;
+        std::vector<EnumerationItem> items;
+
+        const EnumerationItem *getItem(int value) const;
+
+    };
+
+    // a <SimpleType>, shared by all variables declaring it
+    struct SimpleType {
+
+        std::string name;
+        std::optional<std::string> description;
+        // Real, Integer, Boolean, String or Enumeration
+        std::string typeName;
+
+        std::optional<RealType> real;
+        std::optional<IntegerType> integer;
+        std::optional<EnumerationType> enumeration;
+
+        std::optional<std::string_view> quantity() const;
+
+        template<typename T>
+        std::optional<T> min() const {
+            if constexpr (std::is_same<T, double>::value) {
+                return real ? real->min : std::nullopt;
+            } else {
+                return integer ? integer->min : std::nullopt;
+            }
+        }
+
+        template<typename T>
+        std::optional<T> max() const {
+            if constexpr (std::is_same<T, double>::value) {
+                return real ? real->max : std::nullopt;
+            } else {
+                return integer ? integer->max : std::nullopt;
+            }
+        }
+
+    };
+
+    class TypeDefinitions {
+
+    private:
+        std::vector<SimpleType> types_;
+        std::unordered_map<std::string_view, size_t> index_;
+        std::shared_ptr<const UnitDefinitions> units_;
+
+    public:
+
+        TypeDefinitions();
+
+        // resolves the units of the Real types against units
+        TypeDefinitions(const std::vector<SimpleType> &types, const std::shared_ptr<const UnitDefinitions> &units);
+
+        TypeDefinitions(const TypeDefinitions &) = delete;
+        TypeDefinitions &operator=(const TypeDefinitions &) = delete;
+
+        size_t size() const;
+
+        const SimpleType *get(std::string_view name) const;
+
+        const std::shared_ptr<const UnitDefinitions> &units() const;
+
+        std::vector<SimpleType>::const_iterator begin() const;
+        std::vector<SimpleType>::const_iterator end() const;
+
+    };
+
+}
+
+#endif //FMI4CPP_TYPEDEFINITIONS_HPP
@@ -26,6 +26,8 @@
 #define FMI4CPP_TYPEDSCALARVARIABLE_HPP
 
 #include "ScalarVariable.hpp"
+#include "ScalarVariableView.hpp"
+#include "TypeDefinitions.hpp"
 #include "../import/FmuInstance.hpp"
 
 namespace fmi4cpp::fmi2 {
@@ -33,10 +35,8 @@ namespace fmi4cpp::fmi2 {
     template<typename T, typename U>
     class TypedScalarVariable {
 
-    private:
-        const ScalarVariable variable_;
-
     protected:
+        const ScalarVariable variable_;
         const U attribute_;
 
     public:
@@ -44,11 +44,11 @@ namespace fmi4cpp::fmi2 {
         TypedScalarVariable(const ScalarVariable &variable, const U &attribute)
                 : variable_(variable), attribute_(attribute) {}
 
-        std::string name() const {
+        std::string_view name() const {
             return variable_.name();
         }
 
-        std::string description() const {
+        std::string_view description() const {
             return variable_.description();
         }
 
@@ -76,10 +76,14 @@ namespace fmi4cpp::fmi2 {
             return attribute_.start;
         }
 
-        std::optional<std::string> declaredType() const {
+        std::optional<std::string_view> declaredType() const {
             return attribute_.declaredType;
         }
 
+        const SimpleType *typeDefinition() const {
+            return attribute_.type;
+        }
+
         const U &attribute() const {
             return attribute_;
         }
@@ -97,16 +101,18 @@ namespace fmi4cpp::fmi2 {
         BoundedScalarVariable(const ScalarVariable &variable, const U &attribute)
                 : TypedScalarVariable<T, U>(variable, attribute) {}
 
+        // min, max and quantity fall back to the declared type
+
         std::optional<T> min() const {
-            return this->attribute_.min;
+            return BoundedScalarVariableView<T, U>(this->variable_, this->attribute_).min();
         }
 
         std::optional<T> max() const {
-            return this->attribute_.max;
+            return BoundedScalarVariableView<T, U>(this->variable_, this->attribute_).max();
         }
 
-        std::optional<std::string> quantity() const {
-            return this->attribute_.quantity;
+        std::optional<std::string_view> quantity() const {
+            return BoundedScalarVariableView<T, U>(this->variable_, this->attribute_).quantity();
         }
 
     };
@@ -124,6 +130,9 @@ namespace fmi4cpp::fmi2 {
 
     class RealVariable : public BoundedScalarVariable<double, RealAttribute> {
 
+    private:
+        RealVariableView view() const;
+
     public:
 
         RealVariable(const ScalarVariable &variable, const RealAttribute &attribute);
@@ -138,9 +147,13 @@ namespace fmi4cpp::fmi2 {
 
         std::optional<size_t> derivative() const;
 
-        std::optional<std::string> unit() const;
+        std::optional<std::string_view> unit() const;
+
+        std::optional<std::string_view> displayUnit() const;
+
+        const Unit *unitDefinition() const;
 
-        std::optional<std::string> displayUnit() const;
+        const DisplayUnit *displayUnitDefinition() const;
 
         bool read(FmuReader &reader, double &ref) override;
 
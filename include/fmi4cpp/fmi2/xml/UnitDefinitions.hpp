@@ -0,0 +1,132 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_UNITDEFINITIONS_HPP
+#define FMI4CPP_UNITDEFINITIONS_HPP
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace fmi4cpp::fmi2 {
+
+    // exponents of the SI base units, value in base units = factor * value + offset
+    struct BaseUnit {
+
+        int kg = 0;
+        int m = 0;
+        int s = 0;
+        int A = 0;
+        int K = 0;
+        int mol = 0;
+        int cd = 0;
+        int rad = 0;
+
+        double factor = 1;
+        double offset = 0;
+
+        bool sameDimension(const BaseUnit &other) const;
+
+    };
+
+    // value in display unit = factor * value + offset
+    struct DisplayUnit {
+
+        std::string name;
+        double factor = 1;
+        double offset = 0;
+
+        DisplayUnit() = default;
+
+        DisplayUnit(const std::string &name, double factor, double offset);
+
+        double toDisplay(double value) const;
+
+        double fromDisplay(double value) const;
+
+    };
+
+    class Unit {
+
+    private:
+        std::string name_;
+        std::optional<BaseUnit> baseUnit_;
+        std::vector<DisplayUnit> displayUnits_;
+
+        double factor_;
+        double offset_;
+
+    public:
+
+        Unit(const std::string &name, const std::optional<BaseUnit> &baseUnit,
+             const std::vector<DisplayUnit> &displayUnits);
+
+        const std::string &name() const;
+
+        const std::optional<BaseUnit> &baseUnit() const;
+
+        const std::vector<DisplayUnit> &displayUnits() const;
+
+        const DisplayUnit *getDisplayUnit(std::string_view name) const;
+
+        // an undefined BaseUnit is treated as factor 1, offset 0
+        double toBase(double value) const {
+            return factor_ * value + offset_;
+        }
+
+        double fromBase(double value) const {
+            return (value - offset_) / factor_;
+        }
+
+    };
+
+    class UnitDefinitions {
+
+    private:
+        std::vector<Unit> units_;
+        std::unordered_map<std::string_view, size_t> index_;
+
+    public:
+
+        UnitDefinitions() = default;
+
+        explicit UnitDefinitions(const std::vector<Unit> &units);
+
+        UnitDefinitions(const UnitDefinitions &) = delete;
+        UnitDefinitions &operator=(const UnitDefinitions &) = delete;
+
+        size_t size() const;
+
+        const Unit *get(std::string_view name) const;
+
+        std::vector<Unit>::const_iterator begin() const;
+        std::vector<Unit>::const_iterator end() const;
+
+    };
+
+}
+
+#endif //FMI4CPP_UNITDEFINITIONS_HPP
@@ -0,0 +1,151 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_VALUEREFERENCEINDEX_HPP
+#define FMI4CPP_VALUEREFERENCEINDEX_HPP
+
+#include <vector>
+#include <cstdint>
+#include <iterator>
+
+#include <fmi4cpp/fmi2/xml/ScalarVariable.hpp>
+
+namespace fmi4cpp::fmi2 {
+
+    // The variables sharing a value reference within one base type, in declaration order.
+    class AliasGroup {
+
+    private:
+        const ScalarVariable *variables_;
+        const uint32_t *positions_;
+        size_t size_;
+
+    public:
+
+        class iterator {
+
+        private:
+            const ScalarVariable *variables_;
+            const uint32_t *position_;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ScalarVariable;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const ScalarVariable *;
+            using reference = const ScalarVariable &;
+
+            iterator(const ScalarVariable *variables, const uint32_t *position)
+                    : variables_(variables), position_(position) {}
+
+            reference operator*() const {
+                return variables_[*position_];
+            }
+
+            pointer operator->() const {
+                return &variables_[*position_];
+            }
+
+            iterator &operator++() {
+                ++position_;
+                return *this;
+            }
+
+            iterator operator++(int) {
+                iterator it = *this;
+                ++position_;
+                return it;
+            }
+
+            bool operator==(const iterator &other) const {
+                return position_ == other.position_;
+            }
+
+            bool operator!=(const iterator &other) const {
+                return position_ != other.position_;
+            }
+
+        };
+
+        AliasGroup(const ScalarVariable *variables, const uint32_t *positions, size_t size)
+                : variables_(variables), positions_(positions), size_(size) {}
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        const ScalarVariable &operator[](size_t i) const {
+            return variables_[positions_[i]];
+        }
+
+        // index of the i'th member in its ModelVariables
+        size_t position(size_t i) const {
+            return positions_[i];
+        }
+
+        iterator begin() const {
+            return iterator(variables_, positions_);
+        }
+
+        iterator end() const {
+            return iterator(variables_, positions_ + size_);
+        }
+
+    };
+
+    // Hash index from (base type, value reference) to alias group. The groups are stored back to back,
+    // so each lookup is one probe sequence plus a contiguous read.
+    class ValueReferenceIndex {
+
+    private:
+
+        struct Slot {
+            uint64_t key; // (base type << 32 | value reference) + 1, 0 marks an empty slot
+            uint32_t group;
+        };
+
+        std::vector<Slot> slots_;
+        std::vector<uint32_t> groupOffsets_;
+        std::vector<uint32_t> positions_;
+
+    public:
+
+        ValueReferenceIndex() = default;
+
+        explicit ValueReferenceIndex(const std::vector<ScalarVariable> &variables);
+
+        // 'variables' must be the ones the index was built from
+        AliasGroup find(BaseType type, fmi2ValueReference vr, const std::vector<ScalarVariable> &variables) const;
+
+        size_t numberOfGroups() const;
+
+    };
+
+}
+
+#endif //FMI4CPP_VALUEREFERENCEINDEX_HPP
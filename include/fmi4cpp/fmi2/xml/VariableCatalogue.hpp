@@ -0,0 +1,132 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_VARIABLECATALOGUE_HPP
+#define FMI4CPP_VARIABLECATALOGUE_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "enums.hpp"
+#include "VariableSet.hpp"
+#include "ModelVariables.hpp"
+#include "../fmi2TypesPlatform.h"
+
+namespace fmi4cpp::fmi2 {
+
+    // The start values of one base type, laid out as the fmi2Set functions take them.
+    template<typename T>
+    struct StartValues {
+
+        std::vector<fmi2ValueReference> valueReferences;
+        std::vector<T> values;
+
+        // position of each entry in the ModelVariables
+        std::vector<uint32_t> positions;
+
+        size_t size() const {
+            return values.size();
+        }
+
+    };
+
+    // Read-only struct-of-arrays copy of the scalar attributes of a ModelVariables.
+    // Row i of every column describes variable i.
+    class VariableCatalogue {
+
+    private:
+
+        std::vector<fmi2ValueReference> valueReferences_;
+        std::vector<VariableType> types_;
+        std::vector<Causality> causalities_;
+        std::vector<Variability> variabilities_;
+        std::vector<Initial> initials_;
+        std::vector<uint8_t> hasStart_;
+
+        StartValues<fmi2Real> realStarts_;
+        StartValues<fmi2Integer> integerStarts_;
+        StartValues<fmi2Boolean> booleanStarts_;
+        StartValues<fmi2String> stringStarts_;
+
+        // the characters of stringStarts_, each value NUL terminated
+        std::string strings_;
+
+        // one set per enumerator, indexed by its value
+        std::vector<VariableSet> causalitySets_;
+        std::vector<VariableSet> variabilitySets_;
+        std::vector<VariableSet> initialSets_;
+        std::vector<VariableSet> baseTypeSets_;
+
+    public:
+
+        explicit VariableCatalogue(const ModelVariables &variables);
+
+        // stringStarts() points into the catalogue
+        VariableCatalogue(const VariableCatalogue &) = delete;
+        VariableCatalogue &operator=(const VariableCatalogue &) = delete;
+
+        size_t size() const;
+
+        const std::vector<fmi2ValueReference> &valueReferences() const;
+
+        const std::vector<VariableType> &types() const;
+
+        const std::vector<Causality> &causalities() const;
+
+        const std::vector<Variability> &variabilities() const;
+
+        const std::vector<Initial> &initials() const;
+
+        // 1 where the variable declares a start value
+        const std::vector<uint8_t> &hasStart() const;
+
+        const StartValues<fmi2Real> &realStarts() const;
+
+        // Integer and Enumeration variables
+        const StartValues<fmi2Integer> &integerStarts() const;
+
+        const StartValues<fmi2Boolean> &booleanStarts() const;
+
+        const StartValues<fmi2String> &stringStarts() const;
+
+        // Precomputed sets for combined queries, e.g. the continuous real outputs:
+        // withCausality(Causality::output) & withVariability(Variability::continuous) & withBaseType(BaseType::real)
+
+        const VariableSet &withCausality(Causality causality) const;
+
+        const VariableSet &withVariability(Variability variability) const;
+
+        const VariableSet &withInitial(Initial initial) const;
+
+        const VariableSet &withBaseType(BaseType type) const;
+
+        // the value references of the variables in 'set', in declaration order
+        std::vector<fmi2ValueReference> valueReferences(const VariableSet &set) const;
+
+    };
+
+}
+
+#endif //FMI4CPP_VARIABLECATALOGUE_HPP
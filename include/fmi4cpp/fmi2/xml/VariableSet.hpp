@@ -0,0 +1,83 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_VARIABLESET_HPP
+#define FMI4CPP_VARIABLESET_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace fmi4cpp::fmi2 {
+
+    // A set of variable indices stored as one bit per variable, so that combining sets
+    // handles 64 variables per operation. Sets can only be combined when they have the same size.
+    class VariableSet {
+
+    private:
+        std::vector<uint64_t> words_;
+        size_t size_ = 0;
+
+    public:
+
+        VariableSet() = default;
+
+        // an empty set over 'size' variables
+        explicit VariableSet(size_t size);
+
+        // the number of variables the set ranges over
+        size_t size() const;
+
+        // the number of variables in the set
+        size_t count() const;
+
+        bool any() const;
+
+        bool test(size_t index) const;
+
+        void set(size_t index);
+
+        VariableSet &operator&=(const VariableSet &other);
+
+        VariableSet &operator|=(const VariableSet &other);
+
+        // removes the variables in 'other'
+        VariableSet &operator-=(const VariableSet &other);
+
+        VariableSet operator~() const;
+
+        // the indices in the set, ascending
+        std::vector<uint32_t> indices() const;
+
+    };
+
+    VariableSet operator&(VariableSet lhs, const VariableSet &rhs);
+
+    VariableSet operator|(VariableSet lhs, const VariableSet &rhs);
+
+    VariableSet operator-(VariableSet lhs, const VariableSet &rhs);
+
+}
+
+#endif //FMI4CPP_VARIABLESET_HPP
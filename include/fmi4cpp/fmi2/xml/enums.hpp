@@ -29,7 +29,7 @@
 
 namespace fmi4cpp::fmi2 {
 
-    enum class Causality {
+    enum class Causality : unsigned char {
         parameter,
         calculatedParameter,
         input,
@@ -39,7 +39,7 @@ namespace fmi4cpp::fmi2 {
         unknown
     };
 
-    enum class Variability {
+    enum class Variability : unsigned char {
         constant,
         fixed,
         tunable,
@@ -48,25 +48,57 @@ namespace fmi4cpp::fmi2 {
         unknown
     };
 
-    enum class Initial {
+    enum class Initial : unsigned char {
         exact,
         approx,
         calculated,
         unknown
     };
 
+    enum class VariableType : unsigned char {
+        integer,
+        real,
+        string,
+        boolean,
+        enumeration
+    };
+
+    // the fmi2Get/fmi2Set function family a variable is accessed through, value references are unique per base type
+    enum class BaseType : unsigned char {
+        real,
+        integer, // Integer and Enumeration
+        boolean,
+        string
+    };
+
+    enum class DependencyKind : unsigned char {
+        dependent,
+        constant,
+        fixed,
+        tunable,
+        discrete
+    };
+
     Causality parseCausality(const std::string &str);
 
     Variability parseVariability(const std::string &str);
 
     Initial parseInitial(const std::string &str);
 
+    DependencyKind parseDependencyKind(const std::string &str);
+
     const std::string to_string(Causality causality);
 
     const std::string to_string(Variability variability);
 
     const std::string to_string(Initial initial);
 
+    const std::string to_string(VariableType type);
+
+    const std::string to_string(BaseType type);
+
+    const std::string to_string(DependencyKind kind);
+
 }
 
 #endif //FMI4CPP_ENUMS_HPP
@@ -43,7 +43,7 @@ namespace {
         data += "\"Time\", ";
 
         for (unsigned long i = 0; i < variables.size(); i++) {
-            data += "\"" + variables[i].name() + "\"";
+            data += "\"" + std::string(variables[i].name()) + "\"";
             if (i != variables.size() - 1) {
                 data += CSV_SEPARATOR;
             }
@@ -89,18 +89,28 @@ void FmuDriver::run(DriverOptions options) {
     if (options.modelExchange) {
 #if FMI4CPP_WITH_ODEINT
         auto solver = make_solver<EulerSolver>(1E-3);
-        simulate(fmu_->asModelExchangeFmu()->newInstance(solver), options);
+        auto me = fmu_->asModelExchangeFmu();
+        auto slave = me->newInstance(solver);
+        report_ = me->loadReport();
+        simulate(std::move(slave), options);
 #else
         const char *msg = "Model Exchange mode selected, but driver has been built without odeint support!";
         cerr << msg << endl;
         throw Failure(msg);
 #endif
     } else {
-        simulate(fmu_->asCoSimulationFmu()->newInstance(), options);
+        auto cs = fmu_->asCoSimulationFmu();
+        auto slave = cs->newInstance();
+        report_ = cs->loadReport();
+        simulate(std::move(slave), options);
     }
 
 }
 
+const LoadReport &FmuDriver::loadReport() const {
+    return report_;
+}
+
 void FmuDriver::dumpOutput(const string &data, const string &outputFolder) {
 
     const auto fmuName = fs::path(fmu_->fmuFile_).stem().string();
@@ -0,0 +1,174 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+#include <iostream>
+#endif
+
+#include <chrono>
+
+#include <fmi4cpp/fmi2/import/CleanupService.hpp>
+
+#include "../../tools/file_lock.hpp"
+#include "../../tools/tmp_dir_util.hpp"
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    // directories younger than this are never swept, their owner may not hold its lock yet
+    const auto STALE_TMP_DIR_AGE = std::chrono::minutes(10);
+
+    // A process in another pid namespace sharing the directory looks dead to isProcessAlive,
+    // but still holds the lock on its directory.
+    bool isAbandoned(const fs::path &dir) {
+        std::error_code ec;
+        const auto lastWrite = fs::last_write_time(dir, ec);
+        if (ec || fs::file_time_type::clock::now() - lastWrite < STALE_TMP_DIR_AGE) {
+            return false;
+        }
+        const auto lockFile = dir / TMP_DIR_LOCK_NAME;
+        return !fs::exists(lockFile, ec) || tryLockFile(lockFile.string()) != nullptr;
+    }
+
+    void removeDirectory(const fs::path &path) {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+        if (!ec) {
+            std::cout << "Deleted temporal folder '" << path.string() << "'" << std::endl;
+        } else {
+            std::cerr << "Unable to delete temporal folder '" << path.string() << "'" << std::endl;
+        }
+#endif
+    }
+
+}
+
+CleanupService::CleanupService() {
+    busy_ = true;
+    reaper_ = std::thread(&CleanupService::run, this);
+}
+
+CleanupService &CleanupService::instance() {
+    static CleanupService service;
+    return service;
+}
+
+std::vector<fs::path> CleanupService::sweepDirectories() {
+    std::vector<fs::path> dirs{fs::temp_directory_path()};
+#ifdef __linux__
+    std::error_code ec;
+    if (fs::is_directory("/dev/shm", ec)) {
+        dirs.emplace_back("/dev/shm");
+    }
+#endif
+    return dirs;
+}
+
+void CleanupService::run() {
+
+    for (const auto &dir : sweepDirectories()) {
+        sweepStale(dir);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        if (queue_.empty()) {
+            busy_ = false;
+            idle_.notify_all();
+            if (stop_) {
+                return;
+            }
+            workAvailable_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            continue;
+        }
+
+        busy_ = true;
+        const fs::path path = queue_.front();
+        queue_.pop_front();
+
+        lock.unlock();
+        removeDirectory(path);
+        lock.lock();
+    }
+
+}
+
+void CleanupService::schedule(const fs::path &path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!stop_) {
+            queue_.push_back(path);
+            busy_ = true;
+            workAvailable_.notify_one();
+            return;
+        }
+    }
+    removeDirectory(path);
+}
+
+void CleanupService::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return !busy_ && queue_.empty(); });
+}
+
+size_t CleanupService::sweepStale(const fs::path &dir) {
+
+    size_t count = 0;
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+
+        unsigned long pid;
+        const std::string name = it->path().filename().string();
+        if (!parseTmpDirOwner(name, pid) || pid == getCurrentPid() || isProcessAlive(pid)) {
+            continue;
+        }
+
+        std::error_code removeEc;
+        if (fs::is_directory(it->path(), removeEc) && isAbandoned(it->path())) {
+            fs::remove_all(it->path(), removeEc);
+            if (!removeEc) {
+                count++;
+            }
+        }
+    }
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+    if (count > 0) {
+        std::cout << "Removed " << count << " stale temporal folder(s) from '" << dir.string() << "'" << std::endl;
+    }
+#endif
+
+    return count;
+}
+
+CleanupService::~CleanupService() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        workAvailable_.notify_one();
+    }
+    reaper_.join();
+}
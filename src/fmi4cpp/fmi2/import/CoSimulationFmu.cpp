@@ -22,6 +22,8 @@
  * THE SOFTWARE.
  */
 
+#include <chrono>
+
 #include <fmi4cpp/fmi2/import/Fmu.hpp>
 #include <fmi4cpp/fmi2/import/CoSimulationSlave.hpp>
 
@@ -30,35 +32,48 @@ using namespace fmi4cpp::fmi2;
 
 unique_ptr<CoSimulationFmu> Fmu::asCoSimulationFmu() const {
     shared_ptr<CoSimulationModelDescription> cs = std::move(modelDescription_->asCoSimulationModelDescription());
-    return make_unique<CoSimulationFmu>(resource_, cs);
+    return make_unique<CoSimulationFmu>(resource_, cs, report_);
 }
 
 unique_ptr<ModelExchangeFmu> Fmu::asModelExchangeFmu() const {
     shared_ptr<ModelExchangeModelDescription> me = std::move(modelDescription_->asModelExchangeModelDescription());
-    return make_unique<ModelExchangeFmu>(resource_, me);
+    return make_unique<ModelExchangeFmu>(resource_, me, report_);
 }
 
 CoSimulationFmu::CoSimulationFmu(const shared_ptr<FmuResource> &resource,
-                                         const shared_ptr<CoSimulationModelDescription> &md)
-        : resource_(resource), modelDescription_(md) {}
+                                         const shared_ptr<CoSimulationModelDescription> &md,
+                                         const LoadReport &report)
+        : resource_(resource), modelDescription_(md), report_(report) {}
 
 shared_ptr<CoSimulationModelDescription> CoSimulationFmu::getModelDescription() const {
     return modelDescription_;
 }
 
+const LoadReport &CoSimulationFmu::loadReport() const {
+    return report_;
+}
+
 unique_ptr<FmuSlave> CoSimulationFmu::newInstance(const bool visible, const bool loggingOn) {
     shared_ptr<CoSimulationLibrary> lib = nullptr;
     string modelIdentifier = modelDescription_->modelIdentifier();
+    bool reused = false;
     if (modelDescription_->canBeInstantiatedOnlyOncePerProcess()) {
         lib = make_shared<CoSimulationLibrary>(modelIdentifier, resource_);
     } else {
-        if (lib_ == nullptr) {
+        reused = lib_ != nullptr;
+        if (!reused) {
             lib_ = make_shared<CoSimulationLibrary>(modelIdentifier, resource_);
         }
         lib = lib_;
     }
+    report_.libraryReused = reused;
+    report_.dlopen = reused ? LoadReport::duration::zero() : lib->dlopenTime();
+    report_.dlsym = reused ? LoadReport::duration::zero() : lib->dlsymTime();
+
+    const auto start = chrono::steady_clock::now();
     fmi2Component c = lib->instantiate(modelIdentifier, fmi2CoSimulation, guid(),
                                        resource_->getResourcePath(), visible, loggingOn);
+    report_.instantiate = chrono::steady_clock::now() - start;
     return make_unique<CoSimulationSlave>(c, lib, modelDescription_);
 }
 
@@ -22,6 +22,8 @@
  * THE SOFTWARE.
  */
 
+#include <chrono>
+
 #include "FmiLibraryHelper.hpp"
 #include <fmi4cpp/fmi2/import/CoSimulationLibrary.hpp>
 
@@ -31,6 +33,8 @@ CoSimulationLibrary::CoSimulationLibrary(const std::string &modelIdentifier,
                                          const std::shared_ptr<FmuResource> &resource)
         : FmiLibrary(modelIdentifier, resource) {
 
+    const auto start = std::chrono::steady_clock::now();
+
     fmi2SetRealInputDerivatives_ = loadFunction<fmi2SetRealInputDerivativesTYPE *>(handle_,
                                                                                    "fmi2SetRealInputDerivatives");
     fmi2GetRealOutputDerivatives_ = loadFunction<fmi2GetRealOutputDerivativesTYPE *>(handle_,
@@ -45,6 +49,8 @@ CoSimulationLibrary::CoSimulationLibrary(const std::string &modelIdentifier,
     fmi2GetBooleanStatus_ = loadFunction<fmi2GetBooleanStatusTYPE *>(handle_, "fmi2GetBooleanStatusTYPE");
     fmi2GetStringStatus_ = loadFunction<fmi2GetStringStatusTYPE *>(handle_, "fmi2GetStringStatusTYPE");
 
+    dlsymTime_ += std::chrono::steady_clock::now() - start;
+
 }
 
 bool CoSimulationLibrary::doStep(const fmi2Component c, const fmi2Real currentCommunicationPoint,
@@ -0,0 +1,331 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+#include <iostream>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmi4cpp/fmi2/import/ExtractionCache.hpp>
+
+#include "../xml/ModelDescriptionCache.hpp"
+
+#include "../../tools/sha256.hpp"
+#include "../../tools/file_lock.hpp"
+#include "../../tools/unzipper.hpp"
+#include "../../tools/process_util.hpp"
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    const auto LOCK_POLL_INTERVAL = std::chrono::milliseconds(20);
+
+    std::atomic<unsigned long> referenceCounter(0);
+
+    // Advisory lock on a file next to the entry. A process that dies releases it, so a crashed process
+    // never leaves the entry locked.
+    class FileLock {
+
+    private:
+        fs::path path_;
+        std::shared_ptr<void> handle_;
+
+    public:
+        explicit FileLock(const fs::path &path) : path_(path) {}
+
+        FileLock(const FileLock &) = delete;
+        FileLock &operator=(const FileLock &) = delete;
+
+        bool tryLock() {
+            handle_ = tryLockFile(path_.string());
+            return handle_ != nullptr;
+        }
+
+        void lock() {
+            while (!tryLock()) {
+                std::this_thread::sleep_for(LOCK_POLL_INTERVAL);
+            }
+        }
+
+        void unlock() {
+            if (handle_) {
+                // removed while still locked, see tryLockFile
+                std::error_code ec;
+                fs::remove(path_, ec);
+                handle_.reset();
+            }
+        }
+
+        ~FileLock() {
+            unlock();
+        }
+
+    };
+
+    class CachedFmuResource : public FmuResource {
+
+    private:
+        fs::path referenceFile_;
+
+    public:
+        CachedFmuResource(const fs::path &path, const fs::path &referenceFile)
+                : FmuResource(path, false), referenceFile_(referenceFile) {}
+
+        bool hasModelDescriptionCache() const override {
+            return true;
+        }
+
+        ~CachedFmuResource() override {
+            std::error_code ec;
+            fs::remove(referenceFile_, ec);
+        }
+
+    };
+
+    const std::string RUNTIME_ONLY_SUFFIX = "-runtime";
+
+    bool isCacheEntry(const fs::path &path) {
+        const auto name = path.filename().string();
+        if (name.size() != 64 && name != name.substr(0, 64) + RUNTIME_ONLY_SUFFIX) {
+            return false;
+        }
+        return std::all_of(name.begin(), name.begin() + 64, [](char c) {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+        });
+    }
+
+    uintmax_t directorySize(const fs::path &dir) {
+        uintmax_t size = 0;
+        for (const auto &entry : fs::recursive_directory_iterator(dir)) {
+            if (fs::is_regular_file(entry.status())) {
+                size += fs::file_size(entry.path());
+            }
+        }
+        return size;
+    }
+
+    void writeSize(const fs::path &metaFile, uintmax_t size) {
+        std::ofstream out(metaFile.string(), std::ios::out | std::ios::trunc);
+        out << size;
+    }
+
+    uintmax_t readSize(const fs::path &metaFile, const fs::path &entry) {
+        uintmax_t size = 0;
+        std::ifstream in(metaFile.string());
+        if (in >> size) {
+            return size;
+        }
+        return directorySize(entry);
+    }
+
+    void touch(const fs::path &file) {
+        std::error_code ec;
+        fs::last_write_time(file, fs::file_time_type::clock::now(), ec);
+    }
+
+    bool hasLiveReferences(const fs::path &refsDir) {
+        std::error_code ec;
+        if (!fs::exists(refsDir, ec)) {
+            return false;
+        }
+        for (const auto &ref : fs::directory_iterator(refsDir)) {
+            const auto name = ref.path().filename().string();
+            const unsigned long pid = std::strtoul(name.c_str(), nullptr, 10);
+            if (pid != 0 && isProcessAlive(pid)) {
+                return true;
+            }
+            fs::remove(ref.path(), ec);
+        }
+        return false;
+    }
+
+}
+
+const uintmax_t ExtractionCache::DEFAULT_MAX_SIZE = 1024ull * 1024ull * 1024ull;
+
+fs::path ExtractionCache::defaultDirectory() {
+    return fs::temp_directory_path() / "fmi4cpp-cache";
+}
+
+ExtractionCache::ExtractionCache(const fs::path &cacheDir, uintmax_t maxSize)
+        : cacheDir_(cacheDir), maxSize_(maxSize) {
+    fs::create_directories(cacheDir_);
+}
+
+const fs::path &ExtractionCache::directory() const {
+    return cacheDir_;
+}
+
+uintmax_t ExtractionCache::maxSize() const {
+    return maxSize_;
+}
+
+std::string ExtractionCache::hashOf(const std::string &fmuFile) {
+
+    const auto path = fs::canonical(fmuFile);
+    const auto key = path.string() + "|" + std::to_string(fs::file_size(path)) + "|" +
+                     std::to_string(fs::last_write_time(path).time_since_epoch().count());
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = hashes_.find(key);
+        if (it != hashes_.end()) {
+            return it->second;
+        }
+    }
+
+    const auto hash = sha256File(path.string());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    hashes_[key] = hash;
+    return hash;
+}
+
+void ExtractionCache::populate(const std::string &fmuFile, const std::string &key, ExtractionPolicy policy) {
+
+    const auto staging = cacheDir_ / (key + ".tmp");
+
+    std::error_code ec;
+    fs::remove_all(staging, ec);
+    fs::create_directories(staging);
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+    std::cout << "Populating extraction cache entry '" << key << "' from '" << fmuFile << "'" << std::endl;
+#endif
+
+    if (!extractContents(fmuFile, staging.string(), policy)) {
+        fs::remove_all(staging, ec);
+        throw std::runtime_error("Failed to extract FMU!");
+    }
+
+    // written before measuring the entry, so that the recorded size includes it
+    const auto xmlFile = staging / "modelDescription.xml";
+    if (fs::exists(xmlFile)) {
+        parseModelDescriptionCached(xmlFile.string(), (staging / MODEL_DESCRIPTION_CACHE_NAME).string());
+    }
+
+    writeSize(cacheDir_ / (key + ".meta"), directorySize(staging));
+    fs::rename(staging, cacheDir_ / key);
+
+}
+
+std::shared_ptr<FmuResource> ExtractionCache::acquire(const std::string &fmuFile, ExtractionPolicy policy) {
+
+    auto key = hashOf(fmuFile);
+    if (policy == ExtractionPolicy::runtimeOnly) {
+        key += RUNTIME_ONLY_SUFFIX;
+    }
+
+    const auto entry = cacheDir_ / key;
+    const auto refsDir = cacheDir_ / (key + ".refs");
+    const auto refFile = refsDir / (std::to_string(getCurrentPid()) + "_" + std::to_string(referenceCounter++));
+
+    bool populated = false;
+    {
+        FileLock lock(cacheDir_ / (key + ".lock"));
+        lock.lock();
+
+        if (!fs::exists(entry)) {
+            populate(fmuFile, key, policy);
+            populated = true;
+        }
+
+        fs::create_directories(refsDir);
+        std::ofstream(refFile.string()).close();
+        touch(cacheDir_ / (key + ".meta"));
+    }
+
+    auto resource = std::make_shared<CachedFmuResource>(entry, refFile);
+
+    if (populated) {
+        evict();
+    }
+
+    return resource;
+}
+
+void ExtractionCache::evict() {
+
+    struct Entry {
+        fs::path path;
+        uintmax_t size;
+        fs::file_time_type lastUsed;
+    };
+
+    uintmax_t totalSize = 0;
+    std::vector<Entry> entries;
+    for (const auto &p : fs::directory_iterator(cacheDir_)) {
+        if (!fs::is_directory(p.status()) || !isCacheEntry(p.path())) {
+            continue;
+        }
+        const auto metaFile = fs::path(p.path().string() + ".meta");
+        std::error_code ec;
+        auto lastUsed = fs::last_write_time(metaFile, ec);
+        if (ec) {
+            lastUsed = fs::last_write_time(p.path());
+        }
+        entries.push_back({p.path(), readSize(metaFile, p.path()), lastUsed});
+        totalSize += entries.back().size;
+    }
+
+    if (totalSize <= maxSize_) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+        return a.lastUsed < b.lastUsed;
+    });
+
+    for (const auto &entry : entries) {
+
+        if (totalSize <= maxSize_) {
+            break;
+        }
+
+        const auto base = entry.path.string();
+        FileLock lock(base + ".lock");
+        if (!lock.tryLock() || hasLiveReferences(base + ".refs")) {
+            continue;
+        }
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+        std::cout << "Evicting extraction cache entry '" << entry.path.filename().string() << "'" << std::endl;
+#endif
+
+        std::error_code ec;
+        fs::remove_all(entry.path, ec);
+        fs::remove_all(base + ".refs", ec);
+        fs::remove(base + ".meta", ec);
+        totalSize -= entry.size;
+    }
+
+}
@@ -30,6 +30,7 @@
 namespace fs = std::experimental::filesystem;
 #endif
 
+#include <chrono>
 #include <sstream>
 #include <iostream>
 
@@ -84,13 +85,17 @@ FmiLibrary::FmiLibrary(const std::string &modelIdentifier, const std::shared_ptr
     std::cout << "Loading shared library '" << fs::path(libName).stem() << "'" << std::endl;
 #endif
 
+    auto start = std::chrono::steady_clock::now();
     handle_ = loadLibrary(libName);
+    dlopenTime_ = std::chrono::steady_clock::now() - start;
 
     if (!handle_) {
         std::cerr << getLastError() << std::endl;
         throw std::runtime_error("Unable to load dynamic library '" + libName + "'!");
     }
 
+    start = std::chrono::steady_clock::now();
+
     fmi2GetVersion_ = loadFunction<fmi2GetVersionTYPE *>(handle_, "fmi2GetVersion");
     fmi2GetTypesPlatform_ = loadFunction<fmi2GetTypesPlatformTYPE *>(handle_, "fmi2GetTypesPlatform");
 
@@ -126,6 +131,8 @@ FmiLibrary::FmiLibrary(const std::string &modelIdentifier, const std::shared_ptr
 
     fmi2FreeInstance_ = loadFunction<fmi2FreeInstanceTYPE *>(handle_, "fmi2FreeInstance");
 
+    dlsymTime_ = std::chrono::steady_clock::now() - start;
+
 }
 
 bool FmiLibrary::updateStatusAndReturnTrueIfOK(fmi2Status status) {
@@ -133,6 +140,14 @@ bool FmiLibrary::updateStatusAndReturnTrueIfOK(fmi2Status status) {
     return status == fmi2OK;
 }
 
+LoadReport::duration FmiLibrary::dlopenTime() const {
+    return dlopenTime_;
+}
+
+LoadReport::duration FmiLibrary::dlsymTime() const {
+    return dlsymTime_;
+}
+
 fmi2Status FmiLibrary::getLastStatus() const {
     return lastStatus_;
 }
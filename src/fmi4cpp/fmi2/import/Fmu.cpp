@@ -26,31 +26,55 @@
 #include <iostream>
 #endif
 
+#include <chrono>
+#include <fstream>
 #include <experimental/filesystem>
 
 #include <fmi4cpp/fmi2/import/Fmu.hpp>
 #include <fmi4cpp/fmi2/import/CoSimulationSlave.hpp>
 #include <fmi4cpp/fmi2/import/ModelExchangeInstance.hpp>
 
-#include "../xml/ModelDescriptionParser.hpp"
+#include "InMemoryFmuResource.hpp"
+#include "../xml/ModelDescriptionCache.hpp"
 
 #include "../../tools/unzipper.hpp"
 #include "../../tools/os_util.hpp"
-#include "../../tools/simple_id.hpp"
+#include "../../tools/tmp_dir_util.hpp"
 
 using namespace std;
 using namespace fmi4cpp::fmi2;
 
 namespace fs = std::experimental::filesystem;
 
-Fmu::Fmu(const string &fmuFile): fmuFile_(fmuFile) {
+namespace {
+
+    // a directory is used in place, so its path must not depend on the working directory or end in a '/'
+    string normalizeFmuPath(const string &fmuFile) {
+        std::error_code ec;
+        if (fs::is_directory(fmuFile, ec)) {
+            return fs::canonical(fmuFile).string();
+        }
+        return fmuFile;
+    }
+
+}
+
+Fmu::Fmu(const string &fmuFile, ExtractionPolicy policy, unsigned int extractionThreads)
+        : fmuFile_(normalizeFmuPath(fmuFile)) {
 
 #if FMI4CPP_DEBUG_LOGGING_ENABLED
     cout << "Loading FMU '" << fmuFile << "'" << endl;
 #endif
 
+    if (fs::is_directory(fmuFile)) {
+        openDirectory(fmuFile_);
+        return;
+    }
+
+    const auto start = chrono::steady_clock::now();
+
     const string fmuName = fs::path(fmuFile).stem().string();
-    fs::path tmpPath(fs::temp_directory_path() /= fs::path("fmi4cpp_" + fmuName + "_" + generate_simple_id(8)));
+    fs::path tmpPath(fs::temp_directory_path() /= fs::path(generateTmpDirName(fmuName)));
 
     if (!create_directories(tmpPath)) {
         string err = "Failed to create temporary directory!";
@@ -64,17 +88,95 @@ Fmu::Fmu(const string &fmuFile): fmuFile_(fmuFile) {
     cout << "Created temporary directory '" << tmpPath.string() << "'" << endl;
 #endif
 
-    if (!extractContents(fmuFile, tmpPath.string())) {
+    resource_ = make_shared<FmuResource>(tmpPath);
+
+    zip_uint64_t bytesExtracted = 0;
+    if (!extractContents(fmuFile, tmpPath.string(), policy, extractionThreads, &bytesExtracted)) {
         const string err = "Failed to extract FMU!";
 #if FMI4CPP_DEBUG_LOGGING_ENABLED
         cerr << err << endl;
 #endif
         throw runtime_error(err);
     }
+    report_.unzip = chrono::steady_clock::now() - start;
+    report_.bytesExtracted = bytesExtracted;
 
-    resource_ = make_shared<FmuResource>(tmpPath);
-    modelDescription_ = std::move(parseModelDescription(resource_->getModelDescriptionPath()));
+    loadModelDescription();
+
+}
+
+Fmu::Fmu(const string &fmuFile, ExtractionCache &cache, ExtractionPolicy policy): fmuFile_(normalizeFmuPath(fmuFile)) {
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+    cout << "Loading FMU '" << fmuFile << "' through extraction cache '" << cache.directory().string() << "'" << endl;
+#endif
+
+    if (fs::is_directory(fmuFile)) {
+        openDirectory(fmuFile_);
+        return;
+    }
+
+    const auto start = chrono::steady_clock::now();
+    resource_ = cache.acquire(fmuFile, policy);
+    report_.unzip = chrono::steady_clock::now() - start;
+    loadModelDescription();
+
+}
+
+Fmu::Fmu(const vector<uint8_t> &fmuData, const string &fmuName): fmuFile_(fmuName) {
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+    cout << "Loading FMU '" << fmuName << "' from memory" << endl;
+#endif
+
+    const string name = fs::path(fmuName).stem().string();
+    const fs::path tmpPath = InMemoryFmuResource::temporaryDirectory() /= fs::path(generateTmpDirName(name));
+
+    const auto start = chrono::steady_clock::now();
+    const auto resource = make_shared<InMemoryFmuResource>(tmpPath, fmuData.data(), fmuData.size());
+    report_.unzip = chrono::steady_clock::now() - start;
+    report_.bytesExtracted = resource->bytesExtracted();
+
+    resource_ = resource;
+    loadModelDescription();
+
+}
+
+void Fmu::openDirectory(const string &fmuDir) {
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+    cout << "Opening extracted FMU directory '" << fmuDir << "'" << endl;
+#endif
+
+    resource_ = make_shared<FmuResource>(fmuDir, false);
+    if (!fs::exists(resource_->getModelDescriptionPath())) {
+        const string err = "No modelDescription.xml found in '" + fmuDir + "'!";
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+        cerr << err << endl;
+#endif
+        throw runtime_error(err);
+    }
+    loadModelDescription();
+
+}
+
+void Fmu::loadModelDescription() {
+
+    const auto start = chrono::steady_clock::now();
+    if (resource_->hasModelDescriptionCache()) {
+        const string cacheFile = (resource_->path() / MODEL_DESCRIPTION_CACHE_NAME).string();
+        modelDescription_ = parseModelDescriptionCached(resource_->getModelDescriptionPath(), cacheFile,
+                                                        &report_.parseCached);
+    } else {
+        modelDescription_ = parseModelDescription(resource_->getModelDescriptionPath());
+    }
+    report_.parse = chrono::steady_clock::now() - start;
+    report_.numVariables = modelDescription_->numberOfVariables();
+
+}
 
+const LoadReport &Fmu::loadReport() const {
+    return report_;
 }
 
 const std::string Fmu::getFmuFileName() const {
@@ -0,0 +1,83 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <exception>
+
+#include <fmi4cpp/fmi2/import/FmuLoader.hpp>
+
+#include "../../tools/thread_joiner.hpp"
+
+using namespace std;
+using namespace fmi4cpp::fmi2;
+
+future<shared_ptr<Fmu>> fmi4cpp::fmi2::loadFmuAsync(const string &fmuFile, ExtractionPolicy policy) {
+    return async(launch::async, [fmuFile, policy] {
+        return make_shared<Fmu>(fmuFile, policy);
+    });
+}
+
+vector<FmuLoadResult> fmi4cpp::fmi2::loadFmus(const vector<string> &fmuFiles, unsigned int numThreads,
+                                              ExtractionPolicy policy) {
+
+    vector<FmuLoadResult> results(fmuFiles.size());
+    if (fmuFiles.empty()) {
+        return results;
+    }
+
+    if (numThreads == 0) {
+        numThreads = max(1u, thread::hardware_concurrency());
+    }
+    // the threads left over when there are fewer FMUs than threads go to the extraction of each FMU
+    const unsigned int numWorkers = min(numThreads, static_cast<unsigned int>(fmuFiles.size()));
+    const unsigned int extractionThreads = max(1u, numThreads / numWorkers);
+
+    atomic<size_t> next(0);
+    auto worker = [&] {
+        for (size_t i = next++; i < fmuFiles.size(); i = next++) {
+            FmuLoadResult &result = results[i];
+            result.fmuFile = fmuFiles[i];
+            try {
+                result.fmu = make_shared<Fmu>(fmuFiles[i], policy, extractionThreads);
+            } catch (const exception &ex) {
+                result.error = ex.what();
+            } catch (...) {
+                result.error = "Unknown error";
+            }
+        }
+    };
+
+    vector<thread> threads;
+    {
+        ThreadJoiner joiner(threads);
+        for (unsigned int i = 1; i < numWorkers; i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+    }
+
+    return results;
+}
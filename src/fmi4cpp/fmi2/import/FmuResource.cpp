@@ -22,22 +22,35 @@
  * THE SOFTWARE.
  */
 
-#if FMI4CPP_DEBUG_LOGGING_ENABLED
-#include <iostream>
-#endif
-
 #include <fmi4cpp/fmi2/import/FmuResource.hpp>
+#include <fmi4cpp/fmi2/import/CleanupService.hpp>
 
 #include "../../tools/os_util.hpp"
+#include "../../tools/file_lock.hpp"
+#include "../../tools/tmp_dir_util.hpp"
 
 using namespace fmi4cpp::fmi2;
 
-FmuResource::FmuResource(fs::path &path): path_(path){}
+FmuResource::FmuResource(const fs::path &path, bool deleteOnClose): path_(path), deleteOnClose_(deleteOnClose) {
+    if (deleteOnClose_) {
+        // make sure the service outlives this resource, even when it is held by a static
+        CleanupService::instance();
+        ownerLock_ = tryLockFile((path_ / TMP_DIR_LOCK_NAME).string());
+    }
+}
+
+const fs::path &FmuResource::path() const {
+    return path_;
+}
 
 const std::string FmuResource::getModelDescriptionPath() const {
     return path_.string() + "/modelDescription.xml";
 }
 
+bool FmuResource::hasModelDescriptionCache() const {
+    return false;
+}
+
 const std::string FmuResource::getResourcePath() const {
     return "file:///" + path_.string() + "/resources/" + getOs() + "/" + getLibExt();
 }
@@ -47,15 +60,8 @@ const std::string FmuResource::getAbsoluteLibraryPath(const std::string &modelId
 }
 
 FmuResource::~FmuResource() {
-
-    std::error_code success {};
-    fs::remove_all(path_, success);
-#if FMI4CPP_DEBUG_LOGGING_ENABLED
-    if (!success) {
-        std::cout << "Deleted temporal folder '" << path_.string() << "'" <<  std::endl;
-    } else {
-        std::cerr << "Unable to delete temporal folder '" <<  path_.string() << "'" <<  std::endl;
+    if (deleteOnClose_) {
+        ownerLock_.reset();
+        CleanupService::instance().schedule(path_);
     }
-#endif
-
-}
\ No newline at end of file
+}
@@ -0,0 +1,215 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+#include <iostream>
+#endif
+
+#include <stdexcept>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#include "InMemoryFmuResource.hpp"
+
+#include "../../tools/unzipper.hpp"
+#include "../../tools/os_util.hpp"
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    const fs::path &createDirectory(const fs::path &path) {
+        if (!fs::create_directories(path)) {
+            throw std::runtime_error("Failed to create temporary directory!");
+        }
+        return path;
+    }
+
+    bool isLibraryEntry(const std::string &name, const std::string &binaries) {
+        return name.compare(0, binaries.size(), binaries) == 0
+               && name.find('/', binaries.size()) == std::string::npos
+               && name.size() > binaries.size();
+    }
+
+#ifdef __linux__
+
+    bool isBinaryFile(const std::string &name, const std::string &binaries) {
+        return name.compare(0, binaries.size(), binaries) == 0 && name.size() > binaries.size() && name.back() != '/';
+    }
+
+    // files below binaries/<os>/, 0 if the archive cannot be opened
+    size_t countBinaryFiles(const ArchiveOpener &openArchive, const std::string &binaries) {
+        zip_t *za = openArchive();
+        if (za == nullptr) {
+            return 0;
+        }
+        size_t count = 0;
+        const zip_int64_t numEntries = zip_get_num_entries(za, 0);
+        for (zip_int64_t i = 0; i < numEntries; i++) {
+            const char *name = zip_get_name(za, i, 0);
+            if (name != nullptr && isBinaryFile(name, binaries)) {
+                count++;
+            }
+        }
+        zip_discard(za);
+        return count;
+    }
+
+    int copyToMemoryFile(zip_t *za, zip_uint64_t index, zip_uint64_t size, const std::string &name, char *buffer) {
+
+        const int fd = memfd_create(name.c_str(), MFD_CLOEXEC);
+        if (fd < 0) {
+            return -1;
+        }
+
+        const int dupFd = dup(fd);
+        FILE *file = dupFd < 0 ? nullptr : fdopen(dupFd, "wb");
+        if (file == nullptr) {
+            if (dupFd >= 0) {
+                close(dupFd);
+            }
+            close(fd);
+            return -1;
+        }
+
+        const bool success = copyEntry(za, index, size, file, buffer, EXTRACT_BUFFER_SIZE);
+        if (std::fclose(file) != 0 || !success) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+#endif
+
+}
+
+InMemoryFmuResource::InMemoryFmuResource(const fs::path &path, const uint8_t *data, size_t size)
+        : FmuResource(createDirectory(path)) {
+
+    const ArchiveOpener openArchive = openBuffer(data, size);
+    const std::string binaries = "binaries/" + getOs() + "/";
+
+#ifdef __linux__
+    // A library loaded from a memory file cannot find the shared libraries next to it,
+    // so FMUs bundling more than the model library have their binaries extracted to disk.
+    const bool memoryFiles = countBinaryFiles(openArchive, binaries) == 1;
+#endif
+
+    auto filter = [&](const std::string &name) {
+#ifdef __linux__
+        if (memoryFiles && isLibraryEntry(name, binaries)) {
+            return false;
+        }
+#endif
+        return shouldExtract(name, ExtractionPolicy::runtimeOnly);
+    };
+
+    zip_uint64_t bytesExtracted = 0;
+    if (!extractContents(openArchive, path.string(), filter, 0, &bytesExtracted)) {
+        throw std::runtime_error("Failed to extract FMU!");
+    }
+    bytesExtracted_ = bytesExtracted;
+
+#ifdef __linux__
+
+    if (!memoryFiles) {
+        return;
+    }
+
+    zip_t *za = openArchive();
+    if (za == nullptr) {
+        throw std::runtime_error("Failed to open FMU!");
+    }
+
+    // the memory files already opened are closed by libraries_ if this throws
+    try {
+        AlignedBuffer buffer = makeAlignedBuffer(EXTRACT_BUFFER_SIZE);
+        const zip_int64_t numEntries = zip_get_num_entries(za, 0);
+        for (zip_int64_t i = 0; i < numEntries; i++) {
+
+            zip_stat_t zs;
+            if (zip_stat_index(za, i, 0, &zs) != 0 || !isLibraryEntry(zs.name, binaries)) {
+                continue;
+            }
+
+            const std::string fileName = std::string(zs.name).substr(binaries.size());
+            bytesExtracted_ += zs.size;
+            const int fd = copyToMemoryFile(za, i, zs.size, fileName, buffer.get());
+            if (fd >= 0) {
+                libraries_.emplace(fileName, MemoryFile(fd));
+                continue;
+            }
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+            std::cerr << "memfd unavailable for '" << fileName << "', extracting to disk" << std::endl;
+#endif
+            const ZipEntry entry{static_cast<zip_uint64_t>(i), zs.size, path / zs.name};
+            fs::create_directories(entry.path.parent_path());
+            if (!extractEntry(za, entry, buffer.get(), EXTRACT_BUFFER_SIZE)) {
+                throw std::runtime_error("Failed to extract '" + std::string(zs.name) + "'!");
+            }
+        }
+    } catch (...) {
+        zip_discard(za);
+        throw;
+    }
+    zip_discard(za);
+
+#endif
+
+}
+
+const std::string InMemoryFmuResource::getAbsoluteLibraryPath(const std::string &modelIdentifier) const {
+    const auto it = libraries_.find(modelIdentifier + getLibExt());
+    if (it == libraries_.end()) {
+        return FmuResource::getAbsoluteLibraryPath(modelIdentifier);
+    }
+    return "/proc/self/fd/" + std::to_string(it->second.fd());
+}
+
+uintmax_t InMemoryFmuResource::bytesExtracted() const {
+    return bytesExtracted_;
+}
+
+fs::path InMemoryFmuResource::temporaryDirectory() {
+#ifdef __linux__
+    std::error_code ec;
+    if (fs::is_directory("/dev/shm", ec)) {
+        return "/dev/shm";
+    }
+#endif
+    return fs::temp_directory_path();
+}
+
+MemoryFile::~MemoryFile() {
+#ifdef __linux__
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+#endif
+}
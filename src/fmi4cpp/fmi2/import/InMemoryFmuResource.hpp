@@ -0,0 +1,82 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_INMEMORYFMURESOURCE_HPP
+#define FMI4CPP_INMEMORYFMURESOURCE_HPP
+
+#include <string>
+#include <cstdint>
+#include <unordered_map>
+
+#include <fmi4cpp/fmi2/import/FmuResource.hpp>
+
+namespace fmi4cpp::fmi2 {
+
+    // Owns the descriptor of a memory file and closes it on destruction.
+    class MemoryFile {
+
+    private:
+        int fd_;
+
+    public:
+        explicit MemoryFile(int fd) : fd_(fd) {}
+
+        MemoryFile(MemoryFile &&other) noexcept : fd_(other.fd_) {
+            other.fd_ = -1;
+        }
+
+        MemoryFile(const MemoryFile &) = delete;
+        MemoryFile &operator=(const MemoryFile &) = delete;
+        MemoryFile &operator=(MemoryFile &&) = delete;
+
+        int fd() const {
+            return fd_;
+        }
+
+        ~MemoryFile();
+
+    };
+
+    // Unpacks an FMU held in memory. On Linux the shared libraries are kept in anonymous
+    // memory files (memfd) and everything else goes to tmpfs, so nothing touches the disk.
+    class InMemoryFmuResource : public FmuResource {
+
+    private:
+        std::unordered_map<std::string, MemoryFile> libraries_;
+        uintmax_t bytesExtracted_ = 0;
+
+    public:
+        InMemoryFmuResource(const fs::path &path, const uint8_t *data, size_t size);
+
+        const std::string getAbsoluteLibraryPath(const std::string &modelIdentifier) const override;
+
+        uintmax_t bytesExtracted() const;
+
+        static fs::path temporaryDirectory();
+
+    };
+
+}
+
+#endif //FMI4CPP_INMEMORYFMURESOURCE_HPP
@@ -0,0 +1,61 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <iomanip>
+
+#include <fmi4cpp/fmi2/import/LoadReport.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    double toMillis(LoadReport::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+
+}
+
+LoadReport::duration LoadReport::total() const {
+    return unzip + parse + dlopen + dlsym + instantiate;
+}
+
+std::ostream &fmi4cpp::fmi2::operator<<(std::ostream &os, const LoadReport &report) {
+
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+
+    os << std::fixed << std::setprecision(3)
+       << "unzip:           " << toMillis(report.unzip) << " ms\n"
+       << "parse:           " << toMillis(report.parse) << " ms" << (report.parseCached ? " (cached)" : "") << "\n"
+       << "dlopen:          " << toMillis(report.dlopen) << " ms" << (report.libraryReused ? " (reused)" : "") << "\n"
+       << "dlsym:           " << toMillis(report.dlsym) << " ms\n"
+       << "instantiate:     " << toMillis(report.instantiate) << " ms\n"
+       << "total:           " << toMillis(report.total()) << " ms\n"
+       << "bytes extracted: " << report.bytesExtracted << "\n"
+       << "variables:       " << report.numVariables << "\n";
+
+    os.flags(flags);
+    os.precision(precision);
+    return os;
+}
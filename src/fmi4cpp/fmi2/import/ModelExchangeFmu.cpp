@@ -22,6 +22,8 @@
  * THE SOFTWARE.
  */
 
+#include <chrono>
+
 #include <fmi4cpp/fmi2/import/Fmu.hpp>
 #include <fmi4cpp/fmi2/import/ModelExchangeInstance.hpp>
 
@@ -29,27 +31,40 @@ using namespace std;
 using namespace fmi4cpp::fmi2;
 
 ModelExchangeFmu::ModelExchangeFmu(const shared_ptr<FmuResource> &resource,
-                                   const shared_ptr<ModelExchangeModelDescription> &md)
-        : resource_(resource), modelDescription_(md) {}
+                                   const shared_ptr<ModelExchangeModelDescription> &md,
+                                   const LoadReport &report)
+        : resource_(resource), modelDescription_(md), report_(report) {}
 
 
 shared_ptr<ModelExchangeModelDescription> ModelExchangeFmu::getModelDescription() const {
     return modelDescription_;
 }
 
+const LoadReport &ModelExchangeFmu::loadReport() const {
+    return report_;
+}
+
 std::unique_ptr<ModelExchangeInstance> ModelExchangeFmu::newInstance(bool visible, bool loggingOn) {
     shared_ptr<ModelExchangeLibrary> lib = nullptr;
     string modelIdentifier = modelDescription_->modelIdentifier();
+    bool reused = false;
     if (modelDescription_->canBeInstantiatedOnlyOncePerProcess()) {
         lib = make_shared<ModelExchangeLibrary>(modelIdentifier, resource_);
     } else {
-        if (lib_ == nullptr) {
+        reused = lib_ != nullptr;
+        if (!reused) {
             lib_ = make_shared<ModelExchangeLibrary>(modelIdentifier, resource_);
         }
         lib = lib_;
     }
+    report_.libraryReused = reused;
+    report_.dlopen = reused ? LoadReport::duration::zero() : lib->dlopenTime();
+    report_.dlsym = reused ? LoadReport::duration::zero() : lib->dlsymTime();
+
+    const auto start = chrono::steady_clock::now();
     fmi2Component c = lib->instantiate(modelIdentifier, fmi2ModelExchange, guid(),
                                        resource_->getResourcePath(), visible, loggingOn);
+    report_.instantiate = chrono::steady_clock::now() - start;
     return make_unique<ModelExchangeInstance>(c, lib, modelDescription_);
 }
 
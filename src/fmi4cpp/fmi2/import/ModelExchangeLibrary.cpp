@@ -22,6 +22,8 @@
  * THE SOFTWARE.
  */
 
+#include <chrono>
+
 #include "FmiLibraryHelper.hpp"
 #include <fmi4cpp/fmi2/import/ModelExchangeLibrary.hpp>
 
@@ -31,6 +33,8 @@ ModelExchangeLibrary::ModelExchangeLibrary(const std::string &modelIdentifier,
                                            const std::shared_ptr<FmuResource> &resource)
         : FmiLibrary(modelIdentifier, resource) {
 
+    const auto start = std::chrono::steady_clock::now();
+
     fmi2EnterEventMode_ = loadFunction<fmi2EnterEventModeTYPE *>(handle_, "fmi2EnterEventMode");
     fmi2EnterContinuousTimeMode_ = loadFunction<fmi2EnterContinuousTimeModeTYPE *>(
             handle_, "fmi2EnterContinuousTimeMode");
@@ -45,6 +49,8 @@ ModelExchangeLibrary::ModelExchangeLibrary(const std::string &modelIdentifier,
                                                                                    "fmi2CompletedIntegratorStep");
     fmi2NewDiscreteStates_ = loadFunction<fmi2NewDiscreteStatesTYPE *>(handle_, "fmi2NewDiscreteStates");
 
+    dlsymTime_ += std::chrono::steady_clock::now() - start;
+
 }
 
 bool ModelExchangeLibrary::enterEventMode(const fmi2Component c) {
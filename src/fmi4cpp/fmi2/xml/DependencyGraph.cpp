@@ -0,0 +1,195 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <utility>
+#include <algorithm>
+#include <string_view>
+
+#include <fmi4cpp/fmi2/xml/DependencyGraph.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    void parseDependencyKinds(std::string_view str, std::vector<DependencyKind> &kinds) {
+        while (true) {
+            const size_t begin = str.find_first_not_of(" \t\n\r");
+            if (begin == std::string_view::npos) {
+                return;
+            }
+            str.remove_prefix(begin);
+            const size_t end = std::min(str.find_first_of(" \t\n\r"), str.size());
+            kinds.push_back(parseDependencyKind(std::string(str.substr(0, end))));
+            str.remove_prefix(end);
+        }
+    }
+
+    void exclusivePrefixSum(std::vector<size_t> &offsets) {
+        size_t sum = 0;
+        for (auto &offset : offsets) {
+            const size_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+    }
+
+}
+
+DependencyGraph::DependencyGraph(const std::vector<Unknown> &unknowns) {
+
+    size_t numberOfRows = 0;
+    size_t numberOfColumns = 0;
+    unknowns_.reserve(unknowns.size());
+    for (const auto &unknown : unknowns) {
+        unknowns_.push_back(static_cast<unsigned int>(unknown.index()));
+        numberOfRows = std::max(numberOfRows, unknown.index() + 1);
+        if (unknown.dependencies()) {
+            for (const auto dependency : *unknown.dependencies()) {
+                numberOfColumns = std::max(numberOfColumns, static_cast<size_t>(dependency) + 1);
+            }
+        } else {
+            allKnowns_.push_back(unknowns_.back());
+        }
+    }
+    std::sort(allKnowns_.begin(), allKnowns_.end());
+
+    rowOffsets_.assign(numberOfRows + 1, 0);
+    for (const auto &unknown : unknowns) {
+        if (unknown.dependencies()) {
+            rowOffsets_[unknown.index()] += unknown.dependencies()->size();
+        }
+    }
+    exclusivePrefixSum(rowOffsets_);
+
+    const size_t numberOfEdges = rowOffsets_.back();
+    columns_.resize(numberOfEdges);
+    kinds_.resize(numberOfEdges);
+
+    std::vector<size_t> next(rowOffsets_.begin(), rowOffsets_.end() - 1);
+    std::vector<DependencyKind> kinds;
+    for (const auto &unknown : unknowns) {
+        if (!unknown.dependencies()) {
+            continue;
+        }
+        kinds.clear();
+        const auto dependenciesKind = unknown.dependenciesKind();
+        if (dependenciesKind) {
+            parseDependencyKinds(*dependenciesKind, kinds);
+        }
+        const auto &dependencies = *unknown.dependencies();
+        for (size_t i = 0; i < dependencies.size(); i++) {
+            const size_t edge = next[unknown.index()]++;
+            columns_[edge] = dependencies[i];
+            kinds_[edge] = i < kinds.size() ? kinds[i] : DependencyKind::dependent;
+        }
+    }
+
+    // ascending order is required by the standard, dependsOn() relies on it even for files that violate it
+    std::vector<std::pair<unsigned int, DependencyKind>> row;
+    for (size_t r = 0; r < numberOfRows; r++) {
+        const auto first = columns_.begin() + rowOffsets_[r];
+        const auto last = columns_.begin() + rowOffsets_[r + 1];
+        if (std::is_sorted(first, last)) {
+            continue;
+        }
+        row.clear();
+        for (size_t edge = rowOffsets_[r]; edge < rowOffsets_[r + 1]; edge++) {
+            row.emplace_back(columns_[edge], kinds_[edge]);
+        }
+        std::stable_sort(row.begin(), row.end(), [](const auto &a, const auto &b) {
+            return a.first < b.first;
+        });
+        for (size_t i = 0; i < row.size(); i++) {
+            columns_[rowOffsets_[r] + i] = row[i].first;
+            kinds_[rowOffsets_[r] + i] = row[i].second;
+        }
+    }
+
+    columnOffsets_.assign(numberOfColumns + 1, 0);
+    for (const auto column : columns_) {
+        columnOffsets_[column]++;
+    }
+    exclusivePrefixSum(columnOffsets_);
+
+    rows_.resize(numberOfEdges);
+    transposedKinds_.resize(numberOfEdges);
+    next.assign(columnOffsets_.begin(), columnOffsets_.end() - 1);
+    for (size_t r = 0; r < numberOfRows; r++) {
+        for (size_t edge = rowOffsets_[r]; edge < rowOffsets_[r + 1]; edge++) {
+            const size_t transposed = next[columns_[edge]]++;
+            rows_[transposed] = static_cast<unsigned int>(r);
+            transposedKinds_[transposed] = kinds_[edge];
+        }
+    }
+
+}
+
+DependencyRange DependencyGraph::range(const std::vector<size_t> &offsets, const std::vector<unsigned int> &indices,
+                                       const std::vector<DependencyKind> &kinds, size_t i) {
+    if (i + 1 >= offsets.size()) {
+        return DependencyRange(nullptr, nullptr, 0);
+    }
+    return DependencyRange(indices.data() + offsets[i], kinds.data() + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+const std::vector<unsigned int> &DependencyGraph::unknowns() const {
+    return unknowns_;
+}
+
+size_t DependencyGraph::numberOfEdges() const {
+    return columns_.size();
+}
+
+DependencyRange DependencyGraph::dependencies(unsigned int unknown) const {
+    return range(rowOffsets_, columns_, kinds_, unknown);
+}
+
+DependencyRange DependencyGraph::dependents(unsigned int known) const {
+    return range(columnOffsets_, rows_, transposedKinds_, known);
+}
+
+bool DependencyGraph::dependsOnAllKnowns(unsigned int unknown) const {
+    return std::binary_search(allKnowns_.begin(), allKnowns_.end(), unknown);
+}
+
+const std::vector<unsigned int> &DependencyGraph::unknownsDependingOnAllKnowns() const {
+    return allKnowns_;
+}
+
+std::optional<DependencyKind> DependencyGraph::dependsOn(unsigned int unknown, unsigned int known) const {
+    if (dependsOnAllKnowns(unknown)) {
+        return DependencyKind::dependent;
+    }
+    const auto row = dependencies(unknown);
+    const auto it = std::lower_bound(row.begin(), row.end(), known);
+    if (it == row.end() || *it != known) {
+        return std::nullopt;
+    }
+    return row.kind(it - row.begin());
+}
+
+DependencyGraphs::DependencyGraphs(const ModelStructure &structure)
+        : outputs(structure.outputs()),
+          derivatives(structure.derivatives()),
+          initialUnknowns(structure.initialUnknowns()) {}
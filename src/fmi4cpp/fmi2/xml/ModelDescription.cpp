@@ -22,10 +22,36 @@
  * THE SOFTWARE.
  */
 
+#include <mutex>
+
 #include <fmi4cpp/fmi2/xml/ModelDescription.hpp>
 
+#include "ModelDescriptionParser.hpp"
+
+#include "../../tools/unzipper.hpp"
+
 using namespace fmi4cpp::fmi2;
 
+struct ModelDescriptionBase::LazyParts {
+
+    size_t numberOfVariables = 0;
+
+    std::once_flag variablesFlag;
+    std::function<std::shared_ptr<ModelVariables>()> loadVariables;
+    std::shared_ptr<ModelVariables> variables;
+
+    std::once_flag structureFlag;
+    std::function<std::shared_ptr<ModelStructure>()> loadStructure;
+    std::shared_ptr<ModelStructure> structure;
+
+    std::once_flag catalogueFlag;
+    std::shared_ptr<const VariableCatalogue> catalogue;
+
+    std::once_flag graphsFlag;
+    std::shared_ptr<const DependencyGraphs> graphs;
+
+};
+
 ModelDescriptionBase::ModelDescriptionBase(const std::string &guid,
                                            const std::string &fmiVersion,
                                            const std::string &modelName,
@@ -40,12 +66,46 @@ ModelDescriptionBase::ModelDescriptionBase(const std::string &guid,
                                            const size_t numberOfEventIndicators,
                                            const std::shared_ptr<ModelVariables> &modelVariables,
                                            const std::shared_ptr<ModelStructure> &modelStructure,
-                                           const std::optional<DefaultExperiment> &defaultExperiment)
+                                           const std::optional<DefaultExperiment> &defaultExperiment,
+                                           const std::shared_ptr<const TypeDefinitions> &typeDefinitions)
         : guid_(guid), fmiVersion_(fmiVersion), modelName_(modelName), description_(description),
         version_(version), author_(author), license_(license), copyright_(copyright), generationTool_(generationTool),
         generationDateAndTime_(generationDateAndTime), variableNamingConvention_(variableNamingConvention),
-        numberOfEventIndicators_(numberOfEventIndicators), modelVariables_(modelVariables),
-        modelStructure_(modelStructure), defaultExperiment_(defaultExperiment) {}
+        numberOfEventIndicators_(numberOfEventIndicators), lazy_(std::make_shared<LazyParts>()),
+        defaultExperiment_(defaultExperiment),
+        typeDefinitions_(typeDefinitions ? typeDefinitions : std::make_shared<TypeDefinitions>()) {
+    lazy_->numberOfVariables = modelVariables ? modelVariables->size() : 0;
+    lazy_->variables = modelVariables;
+    lazy_->structure = modelStructure;
+}
+
+ModelDescriptionBase::ModelDescriptionBase(const std::string &guid,
+                                           const std::string &fmiVersion,
+                                           const std::string &modelName,
+                                           const std::optional<std::string> &description,
+                                           const std::optional<std::string> &version,
+                                           const std::optional<std::string> &author,
+                                           const std::optional<std::string> &license,
+                                           const std::optional<std::string> &copyright,
+                                           const std::optional<std::string> &generationTool,
+                                           const std::optional<std::string> &generationDateAndTime,
+                                           const std::optional<std::string> &variableNamingConvention,
+                                           const size_t numberOfEventIndicators,
+                                           const size_t numberOfVariables,
+                                           const std::function<std::shared_ptr<ModelVariables>()> &modelVariablesLoader,
+                                           const std::function<std::shared_ptr<ModelStructure>()> &modelStructureLoader,
+                                           const std::optional<DefaultExperiment> &defaultExperiment,
+                                           const std::shared_ptr<const TypeDefinitions> &typeDefinitions)
+        : guid_(guid), fmiVersion_(fmiVersion), modelName_(modelName), description_(description),
+        version_(version), author_(author), license_(license), copyright_(copyright), generationTool_(generationTool),
+        generationDateAndTime_(generationDateAndTime), variableNamingConvention_(variableNamingConvention),
+        numberOfEventIndicators_(numberOfEventIndicators), lazy_(std::make_shared<LazyParts>()),
+        defaultExperiment_(defaultExperiment),
+        typeDefinitions_(typeDefinitions ? typeDefinitions : std::make_shared<TypeDefinitions>()) {
+    lazy_->numberOfVariables = numberOfVariables;
+    lazy_->loadVariables = modelVariablesLoader;
+    lazy_->loadStructure = modelStructureLoader;
+}
 
 std::string ModelDescriptionBase::guid() const {
     return guid_;
@@ -96,27 +156,72 @@ size_t ModelDescriptionBase::numberOfEventIndicators() const {
 }
 
 size_t ModelDescriptionBase::numberOfContinuousStates() const {
-    return modelStructure_->derivatives().size();
+    return modelStructure()->derivatives().size();
 }
  
+size_t ModelDescriptionBase::numberOfVariables() const {
+    return lazy_->numberOfVariables;
+}
+
 const std::shared_ptr<ModelVariables> &ModelDescriptionBase::modelVariables() const {
-    return modelVariables_;
+    std::call_once(lazy_->variablesFlag, [this] {
+        if (lazy_->loadVariables) {
+            lazy_->variables = lazy_->loadVariables();
+            lazy_->loadVariables = nullptr;
+        }
+    });
+    return lazy_->variables;
 }
 
 const std::shared_ptr<ModelStructure> &ModelDescriptionBase::modelStructure() const {
-    return modelStructure_;
+    std::call_once(lazy_->structureFlag, [this] {
+        if (lazy_->loadStructure) {
+            lazy_->structure = lazy_->loadStructure();
+            lazy_->loadStructure = nullptr;
+        }
+    });
+    return lazy_->structure;
+}
+
+const std::shared_ptr<const VariableCatalogue> &ModelDescriptionBase::variableCatalogue() const {
+    std::call_once(lazy_->catalogueFlag, [this] {
+        const auto &variables = modelVariables();
+        lazy_->catalogue = variables ? std::make_shared<const VariableCatalogue>(*variables)
+                                     : std::make_shared<const VariableCatalogue>(ModelVariables());
+    });
+    return lazy_->catalogue;
+}
+
+const std::shared_ptr<const DependencyGraphs> &ModelDescriptionBase::dependencyGraphs() const {
+    std::call_once(lazy_->graphsFlag, [this] {
+        const auto &structure = modelStructure();
+        if (structure) {
+            lazy_->graphs = std::make_shared<const DependencyGraphs>(*structure);
+        } else {
+            lazy_->graphs = std::make_shared<const DependencyGraphs>(ModelStructure());
+        }
+    });
+    return lazy_->graphs;
 }
 
 const std::optional<DefaultExperiment> ModelDescriptionBase::defaultExperiment() const {
     return defaultExperiment_;
 }
 
-const ScalarVariable &ModelDescriptionBase::getVariableByName(const std::string &name) const {
-    return modelVariables_->getByName(name);
+const std::shared_ptr<const TypeDefinitions> &ModelDescriptionBase::typeDefinitions() const {
+    return typeDefinitions_;
+}
+
+const std::shared_ptr<const UnitDefinitions> &ModelDescriptionBase::unitDefinitions() const {
+    return typeDefinitions_->units();
 }
 
-fmi2ValueReference ModelDescriptionBase::getValueReference(const std::string &name) const {
-    return modelVariables_->getByName(name).valueReference();
+const ScalarVariable &ModelDescriptionBase::getVariableByName(std::string_view name) const {
+    return modelVariables()->getByName(name);
+}
+
+fmi2ValueReference ModelDescriptionBase::getValueReference(std::string_view name) const {
+    return modelVariables()->getByName(name).valueReference();
 }
 
 ModelDescription::ModelDescription(const ModelDescriptionBase &base,
@@ -124,6 +229,14 @@ ModelDescription::ModelDescription(const ModelDescriptionBase &base,
                                    const std::optional<ModelExchangeAttributes> &modelExchange)
         : ModelDescriptionBase(base), coSimulation_(coSimulation), modelExchange_(modelExchange) {}
 
+std::unique_ptr<ModelDescription> ModelDescription::fromArchive(const std::string &fmuFile) {
+    std::string xml;
+    if (!readEntry(openFile(fmuFile), "modelDescription.xml", xml)) {
+        throw std::runtime_error("Failed to read modelDescription.xml from '" + fmuFile + "'!");
+    }
+    return parseModelDescriptionXml(std::make_shared<const std::string>(std::move(xml)));
+}
+
 bool ModelDescription::supportsCoSimulation() const {
     return coSimulation_.has_value();
 }
@@ -0,0 +1,776 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_MODELDESCRIPTIONCACHE_HPP
+#define FMI4CPP_MODELDESCRIPTIONCACHE_HPP
+
+#include <string>
+#include <memory>
+#include <cstdio>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <experimental/filesystem>
+
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+#include <iostream>
+#endif
+
+#include <fmi4cpp/fmi2/xml/ModelDescription.hpp>
+#include <fmi4cpp/fmi2/xml/ScalarVariableView.hpp>
+
+#include "ModelDescriptionParser.hpp"
+
+#include "../../tools/sha256.hpp"
+#include "../../tools/mapped_file.hpp"
+#include "../../tools/simple_id.hpp"
+
+namespace {
+
+    using namespace fmi4cpp::fmi2;
+
+    // Binary snapshot of a parsed modelDescription.xml, stored next to it in the extraction directory:
+    //
+    //   magic[8] version:u32 byteOrder:u32 xmlHash:str variablesOffset:u64 structureOffset:u64
+    //   header section | ModelVariables section | ModelStructure section
+    //
+    // Integers are stored in host byte order, strings as u32 length + bytes and optionals as a u8 flag
+    // followed by the value. The sections are decoded lazily, straight from the mapped file.
+    // Bump the version whenever the layout or the meaning of a field changes.
+
+    const char MODEL_DESCRIPTION_CACHE_MAGIC[8] = {'F', 'M', 'I', '4', 'C', 'P', 'P', 'B'};
+    const uint32_t MODEL_DESCRIPTION_CACHE_VERSION = 3;
+    const uint32_t MODEL_DESCRIPTION_CACHE_BYTE_ORDER = 0x01020304;
+    const std::string MODEL_DESCRIPTION_CACHE_NAME = "modelDescription.fmi4cpp.bin";
+
+    enum class CachedType : uint8_t {
+        integer, real, string, boolean, enumeration
+    };
+
+    class CacheWriter {
+
+    private:
+        std::string buffer_;
+
+    public:
+
+        const std::string &buffer() const {
+            return buffer_;
+        }
+
+        size_t offset() const {
+            return buffer_.size();
+        }
+
+        template<typename T>
+        void put(const T &value) {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "not a scalar");
+            buffer_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        void put(std::string_view value) {
+            put(static_cast<uint32_t>(value.size()));
+            buffer_.append(value);
+        }
+
+        void put(const std::string &value) {
+            put(std::string_view(value));
+        }
+
+        template<typename T>
+        void put(const std::optional<T> &value) {
+            put(static_cast<uint8_t>(value.has_value()));
+            if (value) {
+                put(*value);
+            }
+        }
+
+        void put(bool value) {
+            put(static_cast<uint8_t>(value));
+        }
+
+        template<typename T>
+        void patch(size_t offset, const T &value) {
+            std::memcpy(&buffer_[offset], &value, sizeof(T));
+        }
+
+    };
+
+    class CacheReader {
+
+    private:
+        const char *pos_;
+        const char *end_;
+
+        void require(size_t size) const {
+            if (static_cast<size_t>(end_ - pos_) < size) {
+                throw std::runtime_error("Truncated model description cache!");
+            }
+        }
+
+    public:
+
+        CacheReader(const char *begin, const char *end) : pos_(begin), end_(end) {}
+
+        template<typename T>
+        T get() {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "not a scalar");
+            require(sizeof(T));
+            T value;
+            std::memcpy(&value, pos_, sizeof(T));
+            pos_ += sizeof(T);
+            return value;
+        }
+
+        bool getBool() {
+            return get<uint8_t>() != 0;
+        }
+
+        // points into the underlying buffer
+        std::string_view getView() {
+            const auto size = get<uint32_t>();
+            require(size);
+            std::string_view value(pos_, size);
+            pos_ += size;
+            return value;
+        }
+
+        std::string getString() {
+            return std::string(getView());
+        }
+
+        template<typename T>
+        std::optional<T> getOptional() {
+            if (!getBool()) {
+                return std::nullopt;
+            }
+            if constexpr (std::is_same<T, std::string>::value) {
+                return getString();
+            } else if constexpr (std::is_same<T, std::string_view>::value) {
+                return getView();
+            } else if constexpr (std::is_same<T, bool>::value) {
+                return getBool();
+            } else {
+                return get<T>();
+            }
+        }
+
+        bool startsWith(const char *bytes, size_t size) {
+            require(size);
+            const bool match = std::memcmp(pos_, bytes, size) == 0;
+            pos_ += size;
+            return match;
+        }
+
+    };
+
+    void putFmuAttributes(CacheWriter &out, const FmuAttributes &attributes) {
+        out.put(attributes.modelIdentifier);
+        out.put(attributes.canGetAndSetFMUstate);
+        out.put(attributes.canSerializeFMUstate);
+        out.put(attributes.needsExecutionTool);
+        out.put(attributes.canNotUseMemoryManagementFunctions);
+        out.put(attributes.canBeInstantiatedOnlyOncePerProcess);
+        out.put(attributes.providesDirectionalDerivative);
+        out.put(static_cast<uint32_t>(attributes.sourceFiles.size()));
+        for (const auto &file : attributes.sourceFiles) {
+            out.put(file.name);
+        }
+    }
+
+    FmuAttributes getFmuAttributes(CacheReader &in) {
+        const auto modelIdentifier = in.getString();
+        const bool canGetAndSetFMUstate = in.getBool();
+        const bool canSerializeFMUstate = in.getBool();
+        const bool needsExecutionTool = in.getBool();
+        const bool canNotUseMemoryManagementFunctions = in.getBool();
+        const bool canBeInstantiatedOnlyOncePerProcess = in.getBool();
+        const bool providesDirectionalDerivative = in.getBool();
+        SourceFiles sourceFiles;
+        const auto numSourceFiles = in.get<uint32_t>();
+        for (uint32_t i = 0; i < numSourceFiles; i++) {
+            sourceFiles.emplace_back(in.getString());
+        }
+        return FmuAttributes(modelIdentifier, canGetAndSetFMUstate, canSerializeFMUstate, needsExecutionTool,
+                             canNotUseMemoryManagementFunctions, canBeInstantiatedOnlyOncePerProcess,
+                             providesDirectionalDerivative, sourceFiles);
+    }
+
+    void putUnitDefinitions(CacheWriter &out, const UnitDefinitions &units) {
+        out.put(static_cast<uint32_t>(units.size()));
+        for (const auto &unit : units) {
+            out.put(unit.name());
+            const auto &baseUnit = unit.baseUnit();
+            out.put(baseUnit.has_value());
+            if (baseUnit) {
+                for (const int exponent : {baseUnit->kg, baseUnit->m, baseUnit->s, baseUnit->A,
+                                           baseUnit->K, baseUnit->mol, baseUnit->cd, baseUnit->rad}) {
+                    out.put(static_cast<int32_t>(exponent));
+                }
+                out.put(baseUnit->factor);
+                out.put(baseUnit->offset);
+            }
+            out.put(static_cast<uint32_t>(unit.displayUnits().size()));
+            for (const auto &displayUnit : unit.displayUnits()) {
+                out.put(displayUnit.name);
+                out.put(displayUnit.factor);
+                out.put(displayUnit.offset);
+            }
+        }
+    }
+
+    std::shared_ptr<const UnitDefinitions> getUnitDefinitions(CacheReader &in) {
+        std::vector<Unit> units;
+        const auto numUnits = in.get<uint32_t>();
+        for (uint32_t i = 0; i < numUnits; i++) {
+            const auto name = in.getString();
+            std::optional<BaseUnit> baseUnit;
+            if (in.getBool()) {
+                BaseUnit base;
+                for (int *exponent : {&base.kg, &base.m, &base.s, &base.A, &base.K, &base.mol, &base.cd, &base.rad}) {
+                    *exponent = in.get<int32_t>();
+                }
+                base.factor = in.get<double>();
+                base.offset = in.get<double>();
+                baseUnit = base;
+            }
+            std::vector<DisplayUnit> displayUnits;
+            const auto numDisplayUnits = in.get<uint32_t>();
+            for (uint32_t j = 0; j < numDisplayUnits; j++) {
+                const auto displayName = in.getString();
+                const auto factor = in.get<double>();
+                const auto offset = in.get<double>();
+                displayUnits.emplace_back(displayName, factor, offset);
+            }
+            units.emplace_back(name, baseUnit, displayUnits);
+        }
+        return std::make_shared<UnitDefinitions>(units);
+    }
+
+    void putTypeDefinitions(CacheWriter &out, const TypeDefinitions &types) {
+        out.put(static_cast<uint32_t>(types.size()));
+        for (const auto &type : types) {
+            out.put(type.name);
+            out.put(type.description);
+            out.put(type.typeName);
+            out.put(type.real.has_value());
+            if (type.real) {
+                out.put(type.real->quantity);
+                out.put(type.real->unit);
+                out.put(type.real->displayUnit);
+                out.put(type.real->relativeQuantity);
+                out.put(type.real->min);
+                out.put(type.real->max);
+                out.put(type.real->nominal);
+                out.put(type.real->unbounded);
+            }
+            out.put(type.integer.has_value());
+            if (type.integer) {
+                out.put(type.integer->quantity);
+                out.put(type.integer->min);
+                out.put(type.integer->max);
+            }
+            out.put(type.enumeration.has_value());
+            if (type.enumeration) {
+                out.put(type.enumeration->quantity);
+                out.put(static_cast<uint32_t>(type.enumeration->items.size()));
+                for (const auto &item : type.enumeration->items) {
+                    out.put(item.name);
+                    out.put(static_cast<int32_t>(item.value));
+                    out.put(item.description);
+                }
+            }
+        }
+    }
+
+    std::vector<SimpleType> getTypeDefinitions(CacheReader &in) {
+        std::vector<SimpleType> types;
+        const auto numTypes = in.get<uint32_t>();
+        for (uint32_t i = 0; i < numTypes; i++) {
+            SimpleType type;
+            type.name = in.getString();
+            type.description = in.getOptional<std::string>();
+            type.typeName = in.getString();
+            if (in.getBool()) {
+                RealType real;
+                real.quantity = in.getOptional<std::string>();
+                real.unit = in.getOptional<std::string>();
+                real.displayUnit = in.getOptional<std::string>();
+                real.relativeQuantity = in.getBool();
+                real.min = in.getOptional<double>();
+                real.max = in.getOptional<double>();
+                real.nominal = in.getOptional<double>();
+                real.unbounded = in.getBool();
+                type.real = real;
+            }
+            if (in.getBool()) {
+                IntegerType integer;
+                integer.quantity = in.getOptional<std::string>();
+                integer.min = in.getOptional<int>();
+                integer.max = in.getOptional<int>();
+                type.integer = integer;
+            }
+            if (in.getBool()) {
+                EnumerationType enumeration;
+                enumeration.quantity = in.getOptional<std::string>();
+                const auto numItems = in.get<uint32_t>();
+                for (uint32_t j = 0; j < numItems; j++) {
+                    EnumerationItem item;
+                    item.name = in.getString();
+                    item.value = in.get<int32_t>();
+                    item.description = in.getOptional<std::string>();
+                    enumeration.items.push_back(item);
+                }
+                type.enumeration = enumeration;
+            }
+            types.push_back(type);
+        }
+        return types;
+    }
+
+    template<typename T>
+    void putAttribute(CacheWriter &out, const ScalarVariableAttribute<T> &attribute) {
+        out.put(attribute.start);
+        out.put(attribute.declaredType);
+    }
+
+    template<typename T>
+    void putAttribute(CacheWriter &out, const BoundedScalarVariableAttribute<T> &attribute) {
+        putAttribute(out, static_cast<const ScalarVariableAttribute<T> &>(attribute));
+        out.put(attribute.min);
+        out.put(attribute.max);
+        out.put(attribute.quantity);
+    }
+
+    template<typename T>
+    ScalarVariableAttribute<T> getAttribute(CacheReader &in, VariableContext &ctx) {
+        const auto start = in.getOptional<T>();
+        const auto declaredType = ctx.strings.intern(in.getOptional<std::string_view>());
+        ScalarVariableAttribute<T> attribute(start, declaredType);
+        resolveDeclaredType(attribute, ctx.types);
+        return attribute;
+    }
+
+    template<typename T>
+    BoundedScalarVariableAttribute<T> getBoundedAttribute(CacheReader &in, VariableContext &ctx) {
+        BoundedScalarVariableAttribute<T> attribute(getAttribute<T>(in, ctx));
+        attribute.min = in.getOptional<T>();
+        attribute.max = in.getOptional<T>();
+        attribute.quantity = ctx.strings.intern(in.getOptional<std::string_view>());
+        return attribute;
+    }
+
+    void putScalarVariable(CacheWriter &out, const ScalarVariable &v) {
+
+        out.put(v.name());
+        out.put(v.description());
+        out.put(static_cast<uint32_t>(v.valueReference()));
+        out.put(v.canHandleMultipleSetPerTimelnstant());
+        out.put(static_cast<uint8_t>(v.causality()));
+        out.put(static_cast<uint8_t>(v.variability()));
+        out.put(static_cast<uint8_t>(v.initial()));
+
+        if (v.isInteger()) {
+            out.put(CachedType::integer);
+            const auto typed = v.asIntegerView();
+            putAttribute(out, typed.attribute());
+        } else if (v.isReal()) {
+            out.put(CachedType::real);
+            const auto typed = v.asRealView();
+            const RealAttribute &attribute = typed.attribute();
+            putAttribute(out, attribute);
+            out.put(attribute.reinit);
+            out.put(attribute.unbounded);
+            out.put(attribute.relativeQuantity);
+            out.put(attribute.nominal);
+            out.put(attribute.derivative);
+            out.put(attribute.unit);
+            out.put(attribute.displayUnit);
+        } else if (v.isString()) {
+            out.put(CachedType::string);
+            const auto typed = v.asStringView();
+            putAttribute(out, typed.attribute());
+        } else if (v.isBoolean()) {
+            out.put(CachedType::boolean);
+            const auto typed = v.asBooleanView();
+            putAttribute(out, typed.attribute());
+        } else {
+            out.put(CachedType::enumeration);
+            const auto typed = v.asEnumerationView();
+            putAttribute(out, typed.attribute());
+        }
+
+    }
+
+    ScalarVariable getScalarVariable(CacheReader &in, VariableContext &ctx) {
+
+        const auto name = ctx.strings.intern(in.getView());
+        const auto description = ctx.strings.intern(in.getView());
+        const auto valueReference = static_cast<fmi2ValueReference>(in.get<uint32_t>());
+        const bool canHandleMultipleSetPerTimelnstant = in.getBool();
+        const auto causality = static_cast<Causality>(in.get<uint8_t>());
+        const auto variability = static_cast<Variability>(in.get<uint8_t>());
+        const auto initial = static_cast<Initial>(in.get<uint8_t>());
+
+        const ScalarVariableBase base(name, description, valueReference, canHandleMultipleSetPerTimelnstant,
+                                      causality, variability, initial);
+
+        switch (in.get<CachedType>()) {
+            case CachedType::integer:
+                return ScalarVariable(base, IntegerAttribute(getBoundedAttribute<int>(in, ctx)));
+            case CachedType::real: {
+                RealAttribute attribute(getBoundedAttribute<double>(in, ctx));
+                attribute.reinit = in.getBool();
+                attribute.unbounded = in.getBool();
+                attribute.relativeQuantity = in.getBool();
+                attribute.nominal = in.getOptional<double>();
+                attribute.derivative = in.getOptional<unsigned int>();
+                attribute.unit = ctx.strings.intern(in.getOptional<std::string_view>());
+                attribute.displayUnit = ctx.strings.intern(in.getOptional<std::string_view>());
+                resolveUnit(attribute, ctx.types);
+                return ScalarVariable(base, attribute);
+            }
+            case CachedType::string:
+                return ScalarVariable(base, StringAttribute(getAttribute<std::string>(in, ctx)));
+            case CachedType::boolean:
+                return ScalarVariable(base, BooleanAttribute(getAttribute<bool>(in, ctx)));
+            case CachedType::enumeration:
+                return ScalarVariable(base, EnumerationAttribute(getBoundedAttribute<int>(in, ctx)));
+        }
+        throw std::runtime_error("Unknown variable type in model description cache!");
+    }
+
+    void putUnknowns(CacheWriter &out, const std::vector<Unknown> &unknowns) {
+        out.put(static_cast<uint32_t>(unknowns.size()));
+        for (const auto &unknown : unknowns) {
+            out.put(static_cast<uint32_t>(unknown.index()));
+            out.put(unknown.dependenciesKind());
+            const auto &dependencies = unknown.dependencies();
+            out.put(dependencies.has_value());
+            if (dependencies) {
+                out.put(static_cast<uint32_t>(dependencies->size()));
+                for (const auto dependency : *dependencies) {
+                    out.put(static_cast<uint32_t>(dependency));
+                }
+            }
+        }
+    }
+
+    std::vector<Unknown> getUnknowns(CacheReader &in) {
+        std::vector<Unknown> unknowns;
+        const auto size = in.get<uint32_t>();
+        unknowns.reserve(size);
+        for (uint32_t i = 0; i < size; i++) {
+            const auto index = in.get<uint32_t>();
+            const auto dependenciesKind = in.getOptional<std::string>();
+            std::optional<std::vector<unsigned int>> dependencies;
+            if (in.getBool()) {
+                dependencies.emplace(in.get<uint32_t>());
+                for (auto &dependency : *dependencies) {
+                    dependency = in.get<uint32_t>();
+                }
+            }
+            unknowns.emplace_back(index, dependenciesKind, std::move(dependencies));
+        }
+        return unknowns;
+    }
+
+    std::string serializeModelDescription(const ModelDescription &md, const std::string &xmlHash) {
+
+        CacheWriter out;
+        for (const char c : MODEL_DESCRIPTION_CACHE_MAGIC) {
+            out.put(c);
+        }
+        out.put(MODEL_DESCRIPTION_CACHE_VERSION);
+        out.put(MODEL_DESCRIPTION_CACHE_BYTE_ORDER);
+        out.put(xmlHash);
+        const size_t offsets = out.offset();
+        out.put(uint64_t(0));
+        out.put(uint64_t(0));
+
+        out.put(md.guid());
+        out.put(md.fmiVersion());
+        out.put(md.modelName());
+        out.put(md.description());
+        out.put(md.version());
+        out.put(md.author());
+        out.put(md.license());
+        out.put(md.copyright());
+        out.put(md.generationTool());
+        out.put(md.generationDateAndTime());
+        out.put(md.variableNamingConvention());
+        out.put(static_cast<uint64_t>(md.numberOfEventIndicators()));
+        out.put(static_cast<uint64_t>(md.numberOfVariables()));
+
+        const auto defaultExperiment = md.defaultExperiment();
+        out.put(defaultExperiment.has_value());
+        if (defaultExperiment) {
+            out.put(defaultExperiment->startTime);
+            out.put(defaultExperiment->stopTime);
+            out.put(defaultExperiment->stepSize);
+            out.put(defaultExperiment->tolerance);
+        }
+
+        out.put(md.supportsCoSimulation());
+        if (md.supportsCoSimulation()) {
+            const auto cs = md.asCoSimulationModelDescription();
+            const auto &attributes = cs->attributes();
+            putFmuAttributes(out, attributes);
+            out.put(attributes.canInterpolateInputs);
+            out.put(attributes.canRunAsynchronuously);
+            out.put(attributes.canHandleVariableCommunicationStepSize);
+            out.put(static_cast<uint32_t>(attributes.maxOutputDerivativeOrder));
+        }
+
+        out.put(md.supportsModelExchange());
+        if (md.supportsModelExchange()) {
+            const auto me = md.asModelExchangeModelDescription();
+            const auto &attributes = me->attributes();
+            putFmuAttributes(out, attributes);
+            out.put(attributes.completedIntegratorStepNotNeeded);
+        }
+
+        putUnitDefinitions(out, *md.unitDefinitions());
+        putTypeDefinitions(out, *md.typeDefinitions());
+
+        if (const auto &variables = md.modelVariables()) {
+            out.patch(offsets, static_cast<uint64_t>(out.offset()));
+            out.put(static_cast<uint64_t>(variables->size()));
+            for (const auto &v : *variables) {
+                putScalarVariable(out, v);
+            }
+        }
+
+        if (const auto &structure = md.modelStructure()) {
+            out.patch(offsets + sizeof(uint64_t), static_cast<uint64_t>(out.offset()));
+            putUnknowns(out, structure->outputs());
+            putUnknowns(out, structure->derivatives());
+            putUnknowns(out, structure->initialUnknowns());
+        }
+
+        return out.buffer();
+    }
+
+    // returns nullptr if the cache is missing, stale or unreadable.
+    // The sections fall back to xmlFile should they turn out to be corrupt, or throw if there is none.
+    std::unique_ptr<ModelDescription> readModelDescriptionCache(const std::string &cacheFile,
+                                                                const std::string &xmlHash,
+                                                                const std::string &xmlFile) {
+
+        const auto file = MappedFile::open(cacheFile);
+        if (!file) {
+            return nullptr;
+        }
+
+        try {
+
+            CacheReader in(file->data(), file->data() + file->size());
+            if (!in.startsWith(MODEL_DESCRIPTION_CACHE_MAGIC, sizeof(MODEL_DESCRIPTION_CACHE_MAGIC))
+                || in.get<uint32_t>() != MODEL_DESCRIPTION_CACHE_VERSION
+                || in.get<uint32_t>() != MODEL_DESCRIPTION_CACHE_BYTE_ORDER
+                || in.getString() != xmlHash) {
+                return nullptr;
+            }
+            const auto variablesOffset = in.get<uint64_t>();
+            const auto structureOffset = in.get<uint64_t>();
+            if (variablesOffset > file->size() || structureOffset > file->size()) {
+                return nullptr;
+            }
+
+            const auto guid = in.getString();
+            const auto fmiVersion = in.getString();
+            const auto modelName = in.getString();
+            const auto description = in.getOptional<std::string>();
+            const auto version = in.getOptional<std::string>();
+            const auto author = in.getOptional<std::string>();
+            const auto license = in.getOptional<std::string>();
+            const auto copyright = in.getOptional<std::string>();
+            const auto generationTool = in.getOptional<std::string>();
+            const auto generationDateAndTime = in.getOptional<std::string>();
+            const auto variableNamingConvention = in.getOptional<std::string>();
+            const auto numberOfEventIndicators = static_cast<size_t>(in.get<uint64_t>());
+            const auto numberOfVariables = static_cast<size_t>(in.get<uint64_t>());
+
+            std::optional<DefaultExperiment> defaultExperiment;
+            if (in.getBool()) {
+                const auto startTime = in.getOptional<double>();
+                const auto stopTime = in.getOptional<double>();
+                const auto stepSize = in.getOptional<double>();
+                const auto tolerance = in.getOptional<double>();
+                defaultExperiment = DefaultExperiment(startTime, stopTime, stepSize, tolerance);
+            }
+
+            std::optional<CoSimulationAttributes> coSimulation;
+            if (in.getBool()) {
+                const auto attributes = getFmuAttributes(in);
+                const bool canInterpolateInputs = in.getBool();
+                const bool canRunAsynchronuously = in.getBool();
+                const bool canHandleVariableCommunicationStepSize = in.getBool();
+                const auto maxOutputDerivativeOrder = in.get<uint32_t>();
+                coSimulation = CoSimulationAttributes(attributes, canInterpolateInputs, canRunAsynchronuously,
+                                                      canHandleVariableCommunicationStepSize,
+                                                      maxOutputDerivativeOrder);
+            }
+
+            std::optional<ModelExchangeAttributes> modelExchange;
+            if (in.getBool()) {
+                const auto attributes = getFmuAttributes(in);
+                modelExchange = ModelExchangeAttributes(attributes, in.getBool());
+            }
+
+            const auto unitDefinitions = getUnitDefinitions(in);
+            const auto typeDefinitions = std::make_shared<const TypeDefinitions>(getTypeDefinitions(in),
+                                                                                 unitDefinitions);
+
+            std::function<std::shared_ptr<ModelVariables>()> modelVariablesLoader;
+            if (variablesOffset != 0) {
+                modelVariablesLoader = [file, variablesOffset, cacheFile, xmlFile, typeDefinitions] {
+                    try {
+                        CacheReader section(file->data() + variablesOffset, file->data() + file->size());
+                        auto strings = std::make_shared<StringPool>();
+                        VariableContext ctx{*strings, *typeDefinitions};
+                        std::vector<ScalarVariable> variables;
+                        const auto size = section.get<uint64_t>();
+                        variables.reserve(static_cast<size_t>(std::min<uint64_t>(size, file->size())));
+                        for (uint64_t i = 0; i < size; i++) {
+                            variables.push_back(getScalarVariable(section, ctx));
+                        }
+                        strings->shrinkToFit();
+                        return std::make_shared<ModelVariables>(std::move(variables), strings, typeDefinitions);
+                    } catch (const std::exception &) {
+                        if (xmlFile.empty()) {
+                            throw std::runtime_error("Model description cache '" + cacheFile + "' is corrupt!");
+                        }
+                        return parseModelDescription(xmlFile)->modelVariables();
+                    }
+                };
+            }
+
+            std::function<std::shared_ptr<ModelStructure>()> modelStructureLoader;
+            if (structureOffset != 0) {
+                modelStructureLoader = [file, structureOffset, cacheFile, xmlFile] {
+                    try {
+                        CacheReader section(file->data() + structureOffset, file->data() + file->size());
+                        const auto outputs = getUnknowns(section);
+                        const auto derivatives = getUnknowns(section);
+                        const auto initialUnknowns = getUnknowns(section);
+                        return std::make_shared<ModelStructure>(std::move(outputs), std::move(derivatives),
+                                                                std::move(initialUnknowns));
+                    } catch (const std::exception &) {
+                        if (xmlFile.empty()) {
+                            throw std::runtime_error("Model description cache '" + cacheFile + "' is corrupt!");
+                        }
+                        return parseModelDescription(xmlFile)->modelStructure();
+                    }
+                };
+            }
+
+            const ModelDescriptionBase base(guid,
+                                            fmiVersion,
+                                            modelName,
+                                            description,
+                                            version,
+                                            author,
+                                            license,
+                                            copyright,
+                                            generationTool,
+                                            generationDateAndTime,
+                                            variableNamingConvention,
+                                            numberOfEventIndicators,
+                                            numberOfVariables,
+                                            modelVariablesLoader,
+                                            modelStructureLoader,
+                                            defaultExperiment,
+                                            typeDefinitions);
+
+            return std::make_unique<ModelDescription>(base, coSimulation, modelExchange);
+
+        } catch (const std::exception &ex) {
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+            std::cerr << "Ignoring model description cache '" << cacheFile << "': " << ex.what() << std::endl;
+#endif
+            return nullptr;
+        }
+
+    }
+
+    // writes to a temporary file first, so that concurrent readers never see a partial cache
+    bool writeModelDescriptionCache(const ModelDescription &md, const std::string &xmlHash,
+                                    const std::string &cacheFile) {
+
+        const std::string tmpFile = cacheFile + "." + generate_simple_id(8) + ".tmp";
+        FILE *fp = std::fopen(tmpFile.c_str(), "wb");
+        if (fp == nullptr) {
+            return false;
+        }
+
+        bool ok;
+        try {
+            const std::string data = serializeModelDescription(md, xmlHash);
+            ok = std::fwrite(data.data(), 1, data.size(), fp) == data.size();
+        } catch (const std::exception &) {
+            ok = false;
+        }
+        ok = std::fclose(fp) == 0 && ok;
+
+        std::error_code ec;
+        if (ok) {
+            std::experimental::filesystem::rename(tmpFile, cacheFile, ec);
+            ok = !ec;
+        }
+        if (!ok) {
+            std::experimental::filesystem::remove(tmpFile, ec);
+        }
+        return ok;
+    }
+
+    // loads the cache next to xmlFile if it matches the XML, otherwise parses the XML and refreshes the cache
+    std::unique_ptr<ModelDescription> parseModelDescriptionCached(const std::string &xmlFile,
+                                                                  const std::string &cacheFile,
+                                                                  bool *cacheHit = nullptr) {
+
+        const std::string xmlHash = sha256File(xmlFile);
+        auto md = readModelDescriptionCache(cacheFile, xmlHash, xmlFile);
+        if (cacheHit) {
+            *cacheHit = md != nullptr;
+        }
+        if (md) {
+            return md;
+        }
+
+        md = parseModelDescription(xmlFile);
+        if (!writeModelDescriptionCache(*md, xmlHash, cacheFile)) {
+#if FMI4CPP_DEBUG_LOGGING_ENABLED
+            std::cerr << "Unable to write model description cache '" << cacheFile << "'" << std::endl;
+#endif
+        }
+        return md;
+    }
+
+}
+
+#endif //FMI4CPP_MODELDESCRIPTIONCACHE_HPP
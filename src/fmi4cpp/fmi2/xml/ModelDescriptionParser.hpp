@@ -25,12 +25,26 @@
 #ifndef FMI4CPP_MODELDESCRIPTIONPARSER_HPP
 #define FMI4CPP_MODELDESCRIPTIONPARSER_HPP
 
+#include <atomic>
+#include <locale>
+#include <thread>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <sstream>
+#include <optional>
+#include <functional>
+#include <string_view>
+
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 
 #include <fmi4cpp/fmi2/xml/ModelDescription.hpp>
 #include <fmi4cpp/fmi2/xml/ScalarVariableAttribute.hpp>
 
+#include "../../tools/number_parser.hpp"
+#include "../../tools/thread_joiner.hpp"
+#include "../../tools/xml_pull_parser.hpp"
 #include "../../tools/optional_converter.hpp"
 
 using boost::property_tree::ptree;
@@ -40,6 +54,29 @@ namespace {
 
     const std::string DEFAULT_VARIABLE_NAMING_CONVENTION = "flat";
 
+    // ModelVariables sections spanning more than one chunk are parsed on several threads
+    const size_t VARIABLES_PER_CHUNK = 16384;
+
+    // what the ScalarVariables of one ModelVariables share
+    struct VariableContext {
+        StringPool &strings;
+        const TypeDefinitions &types;
+    };
+
+    template<typename T>
+    void resolveDeclaredType(ScalarVariableAttribute<T> &attributes, const TypeDefinitions &types) {
+        attributes.type = attributes.declaredType ? types.get(*attributes.declaredType) : nullptr;
+    }
+
+    // call after resolveDeclaredType, as the unit may be inherited from the declared type
+    void resolveUnit(RealAttribute &attributes, const TypeDefinitions &types) {
+        std::optional<std::string_view> unit = attributes.unit;
+        if (!unit && attributes.type && attributes.type->real && attributes.type->real->unit) {
+            unit = *attributes.type->real->unit;
+        }
+        attributes.unitDefinition = unit ? types.units()->get(*unit) : nullptr;
+    }
+
     DefaultExperiment parseDefaultExperiment(const ptree &node) {
         return DefaultExperiment(
                 convert(node.get_optional<double>("<xmlattr>.startTime")),
@@ -63,27 +100,21 @@ namespace {
         }
     }
 
-    void parseUnknownDependencies(const std::string &str, std::vector<unsigned int> &store) {
-        int i;
-        std::stringstream ss(str);
-        while (ss >> i) {
-            store.push_back(i);
-            if (ss.peek() == ',' || ss.peek() == ' ') {
-                ss.ignore();
-            }
-        }
+    void parseUnknownDependencies(std::string_view str, std::vector<unsigned int> &store) {
+        parseIndexList(str, store);
     }
 
     Unknown parseUnknown(const ptree &node) {
         auto index = node.get<unsigned int>("<xmlattr>.index");
         auto dependenciesKind = convert(node.get_optional<std::string>("<xmlattr>.dependenciesKind"));
 
-        std::vector<unsigned int> dependencies;
+        // left empty when the attribute is missing, meaning that the unknown depends on all knowns
+        std::optional<std::vector<unsigned int>> dependencies;
         auto opt_dependencies = node.get_optional<std::string>("<xmlattr>.dependencies");
         if (opt_dependencies) {
-            parseUnknownDependencies(*opt_dependencies, dependencies);
+            parseUnknownDependencies(*opt_dependencies, dependencies.emplace());
         }
-        return Unknown(index, dependenciesKind, dependencies);
+        return Unknown(index, dependenciesKind, std::move(dependencies));
     }
 
     void loadUnknowns(const ptree &node, std::vector<Unknown> &vector) {
@@ -113,7 +144,8 @@ namespace {
             }
         }
 
-        return std::make_unique<ModelStructure>(outputs, derivatives, initialUnknowns);
+        return std::make_unique<ModelStructure>(std::move(outputs), std::move(derivatives),
+                                                std::move(initialUnknowns));
 
     }
 
@@ -121,12 +153,12 @@ namespace {
 
         auto modelIdentifier = node.get<std::string>("<xmlattr>.modelIdentifier");
 
-        auto needsExecutionTool = node.get<bool>("xmlattr>.needsExecutionTool", false);
-        auto canGetAndSetFMUstate = node.get<bool>("xmlattr>.canGetAndSetFMUstate", false);
-        auto canSerializeFMUstate = node.get<bool>("xmlattr>.canSerializeFMUstate", false);
-        auto providesDirectionalDerivative = node.get<bool>("xmlattr>.providesDirectionalDerivative", false);
-        auto canNotUseMemoryManagementFunctions = node.get<bool>("xmlattr>.canNotUseMemoryManagementFunctions", false);
-        auto canBeInstantiatedOnlyOncePerProcess = node.get<bool>("xmlattr>.canBeInstantiatedOnlyOncePerProcess",
+        auto needsExecutionTool = node.get<bool>("<xmlattr>.needsExecutionTool", false);
+        auto canGetAndSetFMUstate = node.get<bool>("<xmlattr>.canGetAndSetFMUstate", false);
+        auto canSerializeFMUstate = node.get<bool>("<xmlattr>.canSerializeFMUstate", false);
+        auto providesDirectionalDerivative = node.get<bool>("<xmlattr>.providesDirectionalDerivative", false);
+        auto canNotUseMemoryManagementFunctions = node.get<bool>("<xmlattr>.canNotUseMemoryManagementFunctions", false);
+        auto canBeInstantiatedOnlyOncePerProcess = node.get<bool>("<xmlattr>.canBeInstantiatedOnlyOncePerProcess",
                                                                   false);
         SourceFiles sourceFiles;
         for (const ptree::value_type &v : node) {
@@ -161,55 +193,143 @@ namespace {
         return ModelExchangeAttributes(commonAttributes, completedIntegratorStepNotNeeded);
     }
 
+    std::shared_ptr<const UnitDefinitions> parseUnitDefinitions(const ptree &node) {
+        std::vector<Unit> units;
+        for (const ptree::value_type &u : node) {
+            if (u.first != "Unit") {
+                continue;
+            }
+            std::optional<BaseUnit> baseUnit;
+            std::vector<DisplayUnit> displayUnits;
+            for (const ptree::value_type &v : u.second) {
+                if (v.first == "BaseUnit") {
+                    BaseUnit base;
+                    base.kg = v.second.get<int>("<xmlattr>.kg", 0);
+                    base.m = v.second.get<int>("<xmlattr>.m", 0);
+                    base.s = v.second.get<int>("<xmlattr>.s", 0);
+                    base.A = v.second.get<int>("<xmlattr>.A", 0);
+                    base.K = v.second.get<int>("<xmlattr>.K", 0);
+                    base.mol = v.second.get<int>("<xmlattr>.mol", 0);
+                    base.cd = v.second.get<int>("<xmlattr>.cd", 0);
+                    base.rad = v.second.get<int>("<xmlattr>.rad", 0);
+                    base.factor = v.second.get<double>("<xmlattr>.factor", 1);
+                    base.offset = v.second.get<double>("<xmlattr>.offset", 0);
+                    baseUnit = base;
+                } else if (v.first == "DisplayUnit") {
+                    displayUnits.emplace_back(v.second.get<std::string>("<xmlattr>.name"),
+                                              v.second.get<double>("<xmlattr>.factor", 1),
+                                              v.second.get<double>("<xmlattr>.offset", 0));
+                }
+            }
+            units.emplace_back(u.second.get<std::string>("<xmlattr>.name"), baseUnit, displayUnits);
+        }
+        return std::make_shared<UnitDefinitions>(units);
+    }
+
+    std::vector<SimpleType> parseTypeDefinitions(const ptree &node) {
+        std::vector<SimpleType> types;
+        for (const ptree::value_type &t : node) {
+            if (t.first != "SimpleType") {
+                continue;
+            }
+            SimpleType type;
+            type.name = t.second.get<std::string>("<xmlattr>.name");
+            type.description = convert(t.second.get_optional<std::string>("<xmlattr>.description"));
+            for (const ptree::value_type &v : t.second) {
+                const ptree &attributes = v.second;
+                if (v.first == REAL_TYPE) {
+                    RealType real;
+                    real.quantity = convert(attributes.get_optional<std::string>("<xmlattr>.quantity"));
+                    real.unit = convert(attributes.get_optional<std::string>("<xmlattr>.unit"));
+                    real.displayUnit = convert(attributes.get_optional<std::string>("<xmlattr>.displayUnit"));
+                    real.relativeQuantity = attributes.get<bool>("<xmlattr>.relativeQuantity", false);
+                    real.min = convert(attributes.get_optional<double>("<xmlattr>.min"));
+                    real.max = convert(attributes.get_optional<double>("<xmlattr>.max"));
+                    real.nominal = convert(attributes.get_optional<double>("<xmlattr>.nominal"));
+                    real.unbounded = attributes.get<bool>("<xmlattr>.unbounded", false);
+                    type.real = real;
+                } else if (v.first == INTEGER_TYPE) {
+                    IntegerType integer;
+                    integer.quantity = convert(attributes.get_optional<std::string>("<xmlattr>.quantity"));
+                    integer.min = convert(attributes.get_optional<int>("<xmlattr>.min"));
+                    integer.max = convert(attributes.get_optional<int>("<xmlattr>.max"));
+                    type.integer = integer;
+                } else if (v.first == ENUMERATION_TYPE) {
+                    EnumerationType enumeration;
+                    enumeration.quantity = convert(attributes.get_optional<std::string>("<xmlattr>.quantity"));
+                    for (const ptree::value_type &item : attributes) {
+                        if (item.first == "Item") {
+                            enumeration.items.push_back({item.second.get<std::string>("<xmlattr>.name"),
+                                                         item.second.get<int>("<xmlattr>.value"),
+                                                         convert(item.second.get_optional<std::string>(
+                                                                 "<xmlattr>.description"))});
+                        }
+                    }
+                    type.enumeration = enumeration;
+                } else if (v.first != BOOLEAN_TYPE && v.first != STRING_TYPE) {
+                    continue;
+                }
+                type.typeName = v.first;
+            }
+            types.push_back(type);
+        }
+        return types;
+    }
+
     template<typename T>
-    ScalarVariableAttribute<T> parseScalarVariableAttributes(const ptree &node) {
+    ScalarVariableAttribute<T> parseScalarVariableAttributes(const ptree &node, VariableContext &ctx) {
         ScalarVariableAttribute<T> attributes;
         attributes.start = convert(node.get_optional<T>("<xmlattr>.start"));
-        attributes.declaredType = convert(node.get_optional<std::string>("<xmlattr>.declaredType"));
+        const auto declaredType = convert(node.get_optional<std::string>("<xmlattr>.declaredType"));
+        attributes.declaredType = ctx.strings.intern(declaredType);
+        resolveDeclaredType(attributes, ctx.types);
         return attributes;
     }
 
     template<typename T>
-    BoundedScalarVariableAttribute<T> parseBoundedScalarVariableAttributes(const ptree &node) {
-        BoundedScalarVariableAttribute<T> attributes(parseScalarVariableAttributes<T>(node));
+    BoundedScalarVariableAttribute<T> parseBoundedScalarVariableAttributes(const ptree &node, VariableContext &ctx) {
+        BoundedScalarVariableAttribute<T> attributes(parseScalarVariableAttributes<T>(node, ctx));
         attributes.min = convert(node.get_optional<T>("<xmlattr>.min"));
         attributes.max = convert(node.get_optional<T>("<xmlattr>.max"));
-        attributes.quantity = convert(node.get_optional<std::string>("<xmlattr>.quantity"));
+        const auto quantity = convert(node.get_optional<std::string>("<xmlattr>.quantity"));
+        attributes.quantity = ctx.strings.intern(quantity);
         return attributes;
     }
 
-    IntegerAttribute parseIntegerAttribute(const ptree &node) {
-        return IntegerAttribute(parseBoundedScalarVariableAttributes<int>(node));
+    IntegerAttribute parseIntegerAttribute(const ptree &node, VariableContext &ctx) {
+        return IntegerAttribute(parseBoundedScalarVariableAttributes<int>(node, ctx));
     }
 
-    RealAttribute parseRealAttribute(const ptree &node) {
-        RealAttribute attributes(parseBoundedScalarVariableAttributes<double>(node));
+    RealAttribute parseRealAttribute(const ptree &node, VariableContext &ctx) {
+        RealAttribute attributes(parseBoundedScalarVariableAttributes<double>(node, ctx));
         attributes.nominal = convert(node.get_optional<double>("<xmlattr>.nominal"));
-        attributes.unit = convert(node.get_optional<std::string>("<xmlattr>.unit"));
+        attributes.unit = ctx.strings.intern(convert(node.get_optional<std::string>("<xmlattr>.unit")));
         attributes.derivative = convert(node.get_optional<unsigned int>("<xmlattr>.derivative"));
         attributes.reinit = node.get<bool>("<xmlattr>.reinit", false);
         attributes.unbounded = node.get<bool>("<xmlattr>.unbounded", false);
         attributes.relativeQuantity = node.get<bool>("<xmlattr>.relativeQuantity", false);
+        resolveUnit(attributes, ctx.types);
         return attributes;
     }
 
-    StringAttribute parseStringAttribute(const ptree &node) {
-        return StringAttribute(parseScalarVariableAttributes<std::string>(node));
+    StringAttribute parseStringAttribute(const ptree &node, VariableContext &ctx) {
+        return StringAttribute(parseScalarVariableAttributes<std::string>(node, ctx));
     }
 
-    BooleanAttribute parseBooleanAttribute(const ptree &node) {
-        return BooleanAttribute(parseScalarVariableAttributes<bool>(node));
+    BooleanAttribute parseBooleanAttribute(const ptree &node, VariableContext &ctx) {
+        return BooleanAttribute(parseScalarVariableAttributes<bool>(node, ctx));
     }
 
-    EnumerationAttribute parseEnumerationAttribute(const ptree &node) {
-        return EnumerationAttribute(parseBoundedScalarVariableAttributes<int>(node));
+    EnumerationAttribute parseEnumerationAttribute(const ptree &node, VariableContext &ctx) {
+        return EnumerationAttribute(parseBoundedScalarVariableAttributes<int>(node, ctx));
     }
 
 
-    ScalarVariable parseScalarVariable(const ptree &node) {
+    ScalarVariable parseScalarVariable(const ptree &node, VariableContext &ctx) {
 
-        auto name = node.get<std::string>("<xmlattr>.name");
-        auto description = node.get<std::string>("<xmlattr>.description", "");
+        auto name = ctx.strings.intern(std::string_view(node.get<std::string>("<xmlattr>.name")));
+        auto description = ctx.strings.intern(
+                std::string_view(node.get<std::string>("<xmlattr>.description", "")));
         auto valueReference = node.get<fmi2ValueReference>("<xmlattr>.valueReference");
         auto canHandleMultipleSetPerTimelnstant = node.get<bool>("<xmlattr>.canHandleMultipleSetPerTimelnstant", false);
 
@@ -222,15 +342,15 @@ namespace {
 
         for (const ptree::value_type &v : node) {
             if (v.first == INTEGER_TYPE) {
-                return ScalarVariable(base, parseIntegerAttribute(v.second));
+                return ScalarVariable(base, parseIntegerAttribute(v.second, ctx));
             } else if (v.first == REAL_TYPE) {
-                return ScalarVariable(base, parseRealAttribute(v.second));
+                return ScalarVariable(base, parseRealAttribute(v.second, ctx));
             } else if (v.first == STRING_TYPE) {
-                return ScalarVariable(base, parseStringAttribute(v.second));
+                return ScalarVariable(base, parseStringAttribute(v.second, ctx));
             } else if (v.first == BOOLEAN_TYPE) {
-                return ScalarVariable(base, parseBooleanAttribute(v.second));
+                return ScalarVariable(base, parseBooleanAttribute(v.second, ctx));
             } else if (v.first == ENUMERATION_TYPE) {
-                return ScalarVariable(base, parseEnumerationAttribute(v.second));
+                return ScalarVariable(base, parseEnumerationAttribute(v.second, ctx));
             }
         }
 
@@ -238,27 +358,475 @@ namespace {
 
     }
 
-    std::unique_ptr<ModelVariables> parseModelVariables(const ptree &node) {
+    std::unique_ptr<ModelVariables> parseModelVariables(const ptree &node,
+                                                        const std::shared_ptr<const TypeDefinitions> &types) {
+        auto strings = std::make_shared<StringPool>();
+        VariableContext ctx{*strings, *types};
         std::vector<ScalarVariable> variables;
         for (const ptree::value_type &v : node) {
             if (v.first == "ScalarVariable") {
-                auto var = parseScalarVariable(v.second);
-                variables.push_back(var);
+                variables.push_back(parseScalarVariable(v.second, ctx));
             }
         }
-        return std::make_unique<ModelVariables>(variables);
+        strings->shrinkToFit();
+        return std::make_unique<ModelVariables>(std::move(variables), strings, types);
     }
 
-}
+    // Entities are resolved first. Numbers are parsed with std::from_chars, independent of the locale: surrounding
+    // XML whitespace and a leading '+' are allowed, any other trailing text fails the parse. Booleans are
+    // xs:boolean, i.e. "true", "false", "1" or "0". Strings are taken as they are.
+    template<typename T>
+    bool parseAttributeValue(std::string_view raw, T &value) {
+        if (raw.find('&') == std::string_view::npos) {
+            return parseNumber(raw, value);
+        }
+        return parseNumber(XmlPullParser::unescape(raw), value);
+    }
+
+    template<>
+    bool parseAttributeValue<std::string>(std::string_view raw, std::string &value) {
+        value = XmlPullParser::unescape(raw);
+        return true;
+    }
+
+    template<>
+    bool parseAttributeValue<bool>(std::string_view raw, bool &value) {
+        if (raw.find('&') == std::string_view::npos) {
+            return parseBoolean(raw, value);
+        }
+        return parseBoolean(XmlPullParser::unescape(raw), value);
+    }
+
+    template<typename T>
+    std::optional<T> optionalAttribute(const XmlPullParser &parser, std::string_view name) {
+        const std::string_view *raw = parser.rawAttribute(name);
+        T value;
+        if (raw == nullptr || !parseAttributeValue(*raw, value)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    template<typename T>
+    T attribute(const XmlPullParser &parser, std::string_view name, const T &defaultValue) {
+        return optionalAttribute<T>(parser, name).value_or(defaultValue);
+    }
+
+    template<typename T>
+    T requiredAttribute(const XmlPullParser &parser, std::string_view name) {
+        auto value = optionalAttribute<T>(parser, name);
+        if (!value) {
+            parser.fail("missing or invalid attribute '" + std::string(name) + "' on <" +
+                        std::string(parser.name()) + ">");
+        }
+        return *value;
+    }
+
+    std::optional<std::string_view> internedAttribute(const XmlPullParser &parser, std::string_view name,
+                                                      StringPool &strings) {
+        const std::string_view *raw = parser.rawAttribute(name);
+        if (raw == nullptr) {
+            return std::nullopt;
+        }
+        if (raw->find('&') == std::string_view::npos) {
+            return strings.intern(*raw);
+        }
+        return strings.intern(std::string_view(XmlPullParser::unescape(*raw)));
+    }
+
+    DefaultExperiment pullDefaultExperiment(XmlPullParser &parser) {
+        DefaultExperiment experiment(
+                optionalAttribute<double>(parser, "startTime"),
+                optionalAttribute<double>(parser, "stopTime"),
+                optionalAttribute<double>(parser, "stepSize"),
+                optionalAttribute<double>(parser, "tolerance"));
+        parser.skipElement();
+        return experiment;
+    }
+
+    void pullSourceFiles(XmlPullParser &parser, SourceFiles &files) {
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (parser.name() == "File") {
+                files.push_back(SourceFile(requiredAttribute<std::string>(parser, "name")));
+            }
+            parser.skipElement();
+        }
+    }
+
+    FmuAttributes pullFmuAttributes(XmlPullParser &parser) {
+
+        auto modelIdentifier = requiredAttribute<std::string>(parser, "modelIdentifier");
+
+        auto needsExecutionTool = attribute<bool>(parser, "needsExecutionTool", false);
+        auto canGetAndSetFMUstate = attribute<bool>(parser, "canGetAndSetFMUstate", false);
+        auto canSerializeFMUstate = attribute<bool>(parser, "canSerializeFMUstate", false);
+        auto providesDirectionalDerivative = attribute<bool>(parser, "providesDirectionalDerivative", false);
+        auto canNotUseMemoryManagementFunctions = attribute<bool>(parser, "canNotUseMemoryManagementFunctions",
+                                                                  false);
+        auto canBeInstantiatedOnlyOncePerProcess = attribute<bool>(parser, "canBeInstantiatedOnlyOncePerProcess",
+                                                                   false);
+
+        return FmuAttributes(modelIdentifier, canGetAndSetFMUstate, canSerializeFMUstate, needsExecutionTool,
+                             canNotUseMemoryManagementFunctions, canBeInstantiatedOnlyOncePerProcess,
+                             providesDirectionalDerivative, SourceFiles());
+
+    }
+
+    // the children of <CoSimulation> and <ModelExchange>, attributes must have been read before
+    SourceFiles pullFmuSourceFiles(XmlPullParser &parser) {
+        SourceFiles sourceFiles;
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (parser.name() == "SourceFiles") {
+                pullSourceFiles(parser, sourceFiles);
+            } else {
+                parser.skipElement();
+            }
+        }
+        return sourceFiles;
+    }
+
+    CoSimulationAttributes pullCoSimulationAttributes(XmlPullParser &parser) {
+
+        auto commonAttributes = pullFmuAttributes(parser);
+        auto maxOutputDerivativeOrder = attribute<unsigned int>(parser, "maxOutputDerivativeOrder", 0);
+        auto canInterpolateInputs = attribute<bool>(parser, "canInterpolateInputs", false);
+        auto canRunAsynchronuously = attribute<bool>(parser, "canRunAsynchronuously", false);
+        auto canHandleVariableCommunicationStepSize = attribute<bool>(parser,
+                                                                      "canHandleVariableCommunicationStepSize",
+                                                                      false);
+
+        commonAttributes.sourceFiles = pullFmuSourceFiles(parser);
+        return CoSimulationAttributes(commonAttributes, canInterpolateInputs, canRunAsynchronuously,
+                                      canHandleVariableCommunicationStepSize, maxOutputDerivativeOrder);
+
+    }
+
+    ModelExchangeAttributes pullModelExchangeAttributes(XmlPullParser &parser) {
+        auto commonAttributes = pullFmuAttributes(parser);
+        auto completedIntegratorStepNotNeeded = attribute<bool>(parser, "completedIntegratorStepNotNeeded", false);
+        commonAttributes.sourceFiles = pullFmuSourceFiles(parser);
+        return ModelExchangeAttributes(commonAttributes, completedIntegratorStepNotNeeded);
+    }
+
+    std::shared_ptr<const UnitDefinitions> pullUnitDefinitions(XmlPullParser &parser) {
+        std::vector<Unit> units;
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (parser.name() != "Unit") {
+                parser.skipElement();
+                continue;
+            }
+            const auto name = requiredAttribute<std::string>(parser, "name");
+            std::optional<BaseUnit> baseUnit;
+            std::vector<DisplayUnit> displayUnits;
+            while (parser.next() == XmlPullParser::START_ELEMENT) {
+                if (parser.name() == "BaseUnit") {
+                    BaseUnit base;
+                    base.kg = attribute<int>(parser, "kg", 0);
+                    base.m = attribute<int>(parser, "m", 0);
+                    base.s = attribute<int>(parser, "s", 0);
+                    base.A = attribute<int>(parser, "A", 0);
+                    base.K = attribute<int>(parser, "K", 0);
+                    base.mol = attribute<int>(parser, "mol", 0);
+                    base.cd = attribute<int>(parser, "cd", 0);
+                    base.rad = attribute<int>(parser, "rad", 0);
+                    base.factor = attribute<double>(parser, "factor", 1);
+                    base.offset = attribute<double>(parser, "offset", 0);
+                    baseUnit = base;
+                } else if (parser.name() == "DisplayUnit") {
+                    displayUnits.emplace_back(requiredAttribute<std::string>(parser, "name"),
+                                              attribute<double>(parser, "factor", 1),
+                                              attribute<double>(parser, "offset", 0));
+                }
+                parser.skipElement();
+            }
+            units.emplace_back(name, baseUnit, displayUnits);
+        }
+        return std::make_shared<UnitDefinitions>(units);
+    }
+
+    EnumerationType pullEnumerationType(XmlPullParser &parser) {
+        EnumerationType enumeration;
+        enumeration.quantity = optionalAttribute<std::string>(parser, "quantity");
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (parser.name() == "Item") {
+                enumeration.items.push_back({requiredAttribute<std::string>(parser, "name"),
+                                             requiredAttribute<int>(parser, "value"),
+                                             optionalAttribute<std::string>(parser, "description")});
+            }
+            parser.skipElement();
+        }
+        return enumeration;
+    }
+
+    std::vector<SimpleType> pullTypeDefinitions(XmlPullParser &parser) {
+        std::vector<SimpleType> types;
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (parser.name() != "SimpleType") {
+                parser.skipElement();
+                continue;
+            }
+            SimpleType type;
+            type.name = requiredAttribute<std::string>(parser, "name");
+            type.description = optionalAttribute<std::string>(parser, "description");
+            while (parser.next() == XmlPullParser::START_ELEMENT) {
+                const std::string_view name = parser.name();
+                if (name == REAL_TYPE) {
+                    RealType real;
+                    real.quantity = optionalAttribute<std::string>(parser, "quantity");
+                    real.unit = optionalAttribute<std::string>(parser, "unit");
+                    real.displayUnit = optionalAttribute<std::string>(parser, "displayUnit");
+                    real.relativeQuantity = attribute<bool>(parser, "relativeQuantity", false);
+                    real.min = optionalAttribute<double>(parser, "min");
+                    real.max = optionalAttribute<double>(parser, "max");
+                    real.nominal = optionalAttribute<double>(parser, "nominal");
+                    real.unbounded = attribute<bool>(parser, "unbounded", false);
+                    type.real = real;
+                } else if (name == INTEGER_TYPE) {
+                    IntegerType integer;
+                    integer.quantity = optionalAttribute<std::string>(parser, "quantity");
+                    integer.min = optionalAttribute<int>(parser, "min");
+                    integer.max = optionalAttribute<int>(parser, "max");
+                    type.integer = integer;
+                } else if (name == ENUMERATION_TYPE) {
+                    type.typeName = std::string(name);
+                    type.enumeration = pullEnumerationType(parser);
+                    continue;
+                } else if (name != BOOLEAN_TYPE && name != STRING_TYPE) {
+                    parser.skipElement();
+                    continue;
+                }
+                type.typeName = std::string(name);
+                parser.skipElement();
+            }
+            types.push_back(type);
+        }
+        return types;
+    }
 
+    template<typename T>
+    ScalarVariableAttribute<T> pullScalarVariableAttributes(const XmlPullParser &parser, VariableContext &ctx) {
+        ScalarVariableAttribute<T> attributes;
+        attributes.start = optionalAttribute<T>(parser, "start");
+        attributes.declaredType = internedAttribute(parser, "declaredType", ctx.strings);
+        resolveDeclaredType(attributes, ctx.types);
+        return attributes;
+    }
+
+    template<typename T>
+    BoundedScalarVariableAttribute<T> pullBoundedScalarVariableAttributes(const XmlPullParser &parser,
+                                                                          VariableContext &ctx) {
+        BoundedScalarVariableAttribute<T> attributes(pullScalarVariableAttributes<T>(parser, ctx));
+        attributes.min = optionalAttribute<T>(parser, "min");
+        attributes.max = optionalAttribute<T>(parser, "max");
+        attributes.quantity = internedAttribute(parser, "quantity", ctx.strings);
+        return attributes;
+    }
+
+    RealAttribute pullRealAttribute(const XmlPullParser &parser, VariableContext &ctx) {
+        RealAttribute attributes(pullBoundedScalarVariableAttributes<double>(parser, ctx));
+        attributes.nominal = optionalAttribute<double>(parser, "nominal");
+        attributes.unit = internedAttribute(parser, "unit", ctx.strings);
+        attributes.derivative = optionalAttribute<unsigned int>(parser, "derivative");
+        attributes.reinit = attribute<bool>(parser, "reinit", false);
+        attributes.unbounded = attribute<bool>(parser, "unbounded", false);
+        attributes.relativeQuantity = attribute<bool>(parser, "relativeQuantity", false);
+        resolveUnit(attributes, ctx.types);
+        return attributes;
+    }
+
+    ScalarVariable pullScalarVariable(XmlPullParser &parser, VariableContext &ctx) {
+
+        auto name = internedAttribute(parser, "name", ctx.strings);
+        if (!name) {
+            parser.fail("missing attribute 'name' on <ScalarVariable>");
+        }
+        auto description = internedAttribute(parser, "description", ctx.strings).value_or("");
+        auto valueReference = requiredAttribute<fmi2ValueReference>(parser, "valueReference");
+        auto canHandleMultipleSetPerTimelnstant = attribute<bool>(parser, "canHandleMultipleSetPerTimelnstant",
+                                                                  false);
+
+        auto causality = parseCausality(attribute<std::string>(parser, "causality", ""));
+        auto variability = parseVariability(attribute<std::string>(parser, "variability", ""));
+        auto initial = parseInitial(attribute<std::string>(parser, "initial", ""));
+
+        ScalarVariableBase base(*name, description, valueReference, canHandleMultipleSetPerTimelnstant, causality,
+                                variability, initial);
+
+        std::optional<ScalarVariable> variable;
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (!variable) {
+                const std::string_view type = parser.name();
+                if (type == INTEGER_TYPE) {
+                    variable = ScalarVariable(base, IntegerAttribute(
+                            pullBoundedScalarVariableAttributes<int>(parser, ctx)));
+                } else if (type == REAL_TYPE) {
+                    variable = ScalarVariable(base, pullRealAttribute(parser, ctx));
+                } else if (type == STRING_TYPE) {
+                    variable = ScalarVariable(base, StringAttribute(
+                            pullScalarVariableAttributes<std::string>(parser, ctx)));
+                } else if (type == BOOLEAN_TYPE) {
+                    variable = ScalarVariable(base, BooleanAttribute(
+                            pullScalarVariableAttributes<bool>(parser, ctx)));
+                } else if (type == ENUMERATION_TYPE) {
+                    variable = ScalarVariable(base, EnumerationAttribute(
+                            pullBoundedScalarVariableAttributes<int>(parser, ctx)));
+                }
+            }
+            parser.skipElement();
+        }
+
+        if (!variable) {
+            throw std::runtime_error("FATAL: Failed to parse ScalarVariable!");
+        }
+        return *variable;
+
+    }
+
+    void pullScalarVariables(XmlPullParser &parser, VariableContext &ctx, std::vector<ScalarVariable> &variables) {
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (parser.name() == "ScalarVariable") {
+                variables.push_back(pullScalarVariable(parser, ctx));
+            } else {
+                parser.skipElement();
+            }
+        }
+    }
+
+    std::unique_ptr<ModelVariables> pullModelVariables(XmlPullParser &parser,
+                                                       const std::shared_ptr<const TypeDefinitions> &types,
+                                                       size_t numberOfVariables = 0) {
+        auto strings = std::make_shared<StringPool>();
+        VariableContext ctx{*strings, *types};
+        std::vector<ScalarVariable> variables;
+        variables.reserve(numberOfVariables);
+        pullScalarVariables(parser, ctx, variables);
+        strings->shrinkToFit();
+        return std::make_unique<ModelVariables>(std::move(variables), strings, types);
+    }
+
+    // Parses the ScalarVariable elements of [chunks[i], chunks[i + 1]) with one string pool per chunk,
+    // the last chunk ends at 'end'. The chunks are concatenated in document order.
+    std::unique_ptr<ModelVariables> pullModelVariables(const char *document,
+                                                       const std::vector<size_t> &chunks,
+                                                       size_t end,
+                                                       const std::shared_ptr<const TypeDefinitions> &types,
+                                                       size_t numberOfVariables = 0,
+                                                       unsigned int numThreads = 0) {
+
+        std::vector<std::vector<ScalarVariable>> parts(chunks.size());
+        std::vector<StringPool> pools(chunks.size());
+        std::vector<std::exception_ptr> errors(chunks.size());
+
+        if (numThreads == 0) {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        numThreads = static_cast<unsigned int>(std::min<size_t>(numThreads, chunks.size()));
+
+        std::atomic<size_t> next(0);
+        auto worker = [&] {
+            for (size_t i = next++; i < chunks.size(); i = next++) {
+                try {
+                    const size_t chunkEnd = i + 1 < chunks.size() ? chunks[i + 1] : end;
+                    XmlPullParser parser(document + chunks[i], document + chunkEnd);
+                    VariableContext ctx{pools[i], *types};
+                    pullScalarVariables(parser, ctx, parts[i]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        {
+            ThreadJoiner joiner(threads);
+            for (unsigned int t = 1; t < numThreads; t++) {
+                threads.emplace_back(worker);
+            }
+            worker();
+        }
+
+        for (const auto &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        auto strings = std::make_shared<StringPool>();
+        std::vector<ScalarVariable> variables;
+        variables.reserve(numberOfVariables);
+        for (size_t i = 0; i < chunks.size(); i++) {
+            variables.insert(variables.end(), std::make_move_iterator(parts[i].begin()),
+                             std::make_move_iterator(parts[i].end()));
+            std::vector<ScalarVariable>().swap(parts[i]);
+            strings->merge(std::move(pools[i]));
+        }
+        strings->shrinkToFit();
+        return std::make_unique<ModelVariables>(std::move(variables), strings, types);
+    }
+
+    void pullUnknowns(XmlPullParser &parser, std::vector<Unknown> &store) {
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            if (parser.name() == "Unknown") {
+                auto index = requiredAttribute<unsigned int>(parser, "index");
+                auto dependenciesKind = optionalAttribute<std::string>(parser, "dependenciesKind");
+
+                std::optional<std::vector<unsigned int>> dependencies;
+                const std::string_view *rawDependencies = parser.rawAttribute("dependencies");
+                if (rawDependencies != nullptr) {
+                    parseUnknownDependencies(*rawDependencies, dependencies.emplace());
+                }
+                store.emplace_back(index, dependenciesKind, std::move(dependencies));
+            }
+            parser.skipElement();
+        }
+    }
+
+    // also records the offset of every variablesPerChunk'th ScalarVariable
+    size_t skipAndCountVariables(XmlPullParser &parser, std::vector<size_t> &chunks, size_t variablesPerChunk) {
+        size_t count = 0;
+        while (parser.next(false) == XmlPullParser::START_ELEMENT) {
+            if (parser.name() == "ScalarVariable") {
+                if (count % variablesPerChunk == 0) {
+                    chunks.push_back(parser.tagOffset());
+                }
+                count++;
+            }
+            parser.skipElement();
+        }
+        return count;
+    }
+
+    std::unique_ptr<ModelStructure> pullModelStructure(XmlPullParser &parser) {
+
+        std::vector<Unknown> outputs;
+        std::vector<Unknown> derivatives;
+        std::vector<Unknown> initialUnknowns;
+
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+            const std::string_view name = parser.name();
+            if (name == "Outputs") {
+                pullUnknowns(parser, outputs);
+            } else if (name == "Derivatives") {
+                pullUnknowns(parser, derivatives);
+            } else if (name == "InitialUnknowns") {
+                pullUnknowns(parser, initialUnknowns);
+            } else {
+                parser.skipElement();
+            }
+        }
+
+        return std::make_unique<ModelStructure>(std::move(outputs), std::move(derivatives),
+                                                std::move(initialUnknowns));
+
+    }
+
+}
 
 namespace fmi4cpp::fmi2 {
 
-    std::unique_ptr<ModelDescription> parseModelDescription(const std::string &fileName) {
+    inline std::unique_ptr<ModelDescription> parseModelDescription(const ptree &tree) {
 
-        ptree tree;
-        read_xml(fileName, tree);
-        ptree root = tree.get_child("fmiModelDescription");
+        const ptree &root = tree.get_child("fmiModelDescription");
 
         auto guid = root.get<std::string>("<xmlattr>.guid");
         auto fmiVersion = root.get<std::string>("<xmlattr>.fmiVersion");
@@ -280,6 +848,17 @@ namespace fmi4cpp::fmi2 {
         std::optional<CoSimulationAttributes> coSimulation;
         std::optional<ModelExchangeAttributes> modelExchange;
 
+        std::shared_ptr<const UnitDefinitions> unitDefinitions;
+        std::vector<SimpleType> simpleTypes;
+        for (const ptree::value_type &v : root) {
+            if (v.first == "UnitDefinitions") {
+                unitDefinitions = parseUnitDefinitions(v.second);
+            } else if (v.first == "TypeDefinitions") {
+                simpleTypes = parseTypeDefinitions(v.second);
+            }
+        }
+        const auto typeDefinitions = std::make_shared<const TypeDefinitions>(simpleTypes, unitDefinitions);
+
         for (const ptree::value_type &v : root) {
 
             if (v.first == "CoSimulation") {
@@ -289,7 +868,7 @@ namespace fmi4cpp::fmi2 {
             } else if (v.first == "DefaultExperiment") {
                 defaultExperiment = parseDefaultExperiment(v.second);
             } else if (v.first == "ModelVariables") {
-                modelVariables = std::move(parseModelVariables(v.second));
+                modelVariables = std::move(parseModelVariables(v.second, typeDefinitions));
             } else if (v.first == "ModelStructure") {
                 modelStructure = std::move(parseModelStructure(v.second));
             }
@@ -310,12 +889,166 @@ namespace fmi4cpp::fmi2 {
                                         numberOfEventIndicators,
                                         modelVariables,
                                         modelStructure,
-                                        defaultExperiment);
+                                        defaultExperiment,
+                                        typeDefinitions);
 
         return std::make_unique<ModelDescription>(base, coSimulation, modelExchange);
 
     }
 
+    inline std::unique_ptr<ModelDescription> parseModelDescriptionPtree(const std::string &xml) {
+        ptree tree;
+        std::istringstream stream(xml);
+        read_xml(stream, tree);
+        return parseModelDescription(tree);
+    }
+
+    // Reads the header of the document in a single pass without creating a DOM. ModelVariables and
+    // ModelStructure are only delimited here; they are parsed from the retained document on first access.
+    inline std::unique_ptr<ModelDescription> pullModelDescription(const std::shared_ptr<const std::string> &xml,
+                                                                  size_t variablesPerChunk = VARIABLES_PER_CHUNK) {
+
+        if (variablesPerChunk == 0) {
+            throw std::invalid_argument("variablesPerChunk must be greater than zero!");
+        }
+
+        XmlPullParser parser(xml->data(), xml->data() + xml->size());
+        if (parser.next() != XmlPullParser::START_ELEMENT || parser.name() != "fmiModelDescription") {
+            parser.fail("expected <fmiModelDescription>");
+        }
+
+        auto guid = requiredAttribute<std::string>(parser, "guid");
+        auto fmiVersion = requiredAttribute<std::string>(parser, "fmiVersion");
+        auto modelName = requiredAttribute<std::string>(parser, "modelName");
+        auto description = attribute<std::string>(parser, "description", "");
+        auto author = attribute<std::string>(parser, "author", "");
+        auto version = attribute<std::string>(parser, "version", "");
+        auto license = attribute<std::string>(parser, "license", "");
+        auto copyright = attribute<std::string>(parser, "copyright", "");
+        auto generationTool = attribute<std::string>(parser, "generationTool", "");
+        auto generationDateAndTime = attribute<std::string>(parser, "generationDateAndTime", "");
+        auto numberOfEventIndicators = attribute<size_t>(parser, "numberOfEventIndicators", 0);
+        auto variableNamingConvention = attribute<std::string>(parser, "variableNamingConvention",
+                                                               DEFAULT_VARIABLE_NAMING_CONVENTION);
+
+        size_t numberOfVariables = 0;
+        std::function<std::shared_ptr<ModelVariables>()> modelVariablesLoader;
+        std::function<std::shared_ptr<ModelStructure>()> modelStructureLoader;
+        std::optional<DefaultExperiment> defaultExperiment;
+        std::optional<CoSimulationAttributes> coSimulation;
+        std::optional<ModelExchangeAttributes> modelExchange;
+        std::shared_ptr<const UnitDefinitions> unitDefinitions;
+        std::vector<SimpleType> simpleTypes;
+        std::optional<std::pair<size_t, size_t>> variablesSpan;
+        std::vector<size_t> variableChunks;
+        size_t variableChunksEnd = 0;
+        std::optional<std::pair<size_t, size_t>> structureSpan;
+
+        while (parser.next() == XmlPullParser::START_ELEMENT) {
+
+            const std::string_view name = parser.name();
+            if (name == "UnitDefinitions") {
+                unitDefinitions = pullUnitDefinitions(parser);
+            } else if (name == "TypeDefinitions") {
+                simpleTypes = pullTypeDefinitions(parser);
+            } else if (name == "CoSimulation") {
+                coSimulation = pullCoSimulationAttributes(parser);
+            } else if (name == "ModelExchange") {
+                modelExchange = pullModelExchangeAttributes(parser);
+            } else if (name == "DefaultExperiment") {
+                defaultExperiment = pullDefaultExperiment(parser);
+            } else if (name == "ModelVariables") {
+                const size_t begin = parser.tagOffset();
+                numberOfVariables = skipAndCountVariables(parser, variableChunks, variablesPerChunk);
+                variablesSpan.emplace(begin, parser.offset());
+                variableChunksEnd = parser.tagOffset();
+            } else if (name == "ModelStructure") {
+                const size_t begin = parser.tagOffset();
+                parser.skipElement();
+                structureSpan.emplace(begin, parser.offset());
+            } else {
+                parser.skipElement();
+            }
+
+        }
+
+        if (parser.next() != XmlPullParser::END_DOCUMENT) {
+            parser.fail("content after the root element");
+        }
+
+        const auto typeDefinitions = std::make_shared<const TypeDefinitions>(simpleTypes, unitDefinitions);
+
+        if (variablesSpan) {
+            const size_t begin = variablesSpan->first;
+            const size_t end = variablesSpan->second;
+            modelVariablesLoader = [xml, begin, end, numberOfVariables, typeDefinitions,
+                    variableChunks, variableChunksEnd] {
+                if (variableChunks.size() > 1) {
+                    return std::shared_ptr<ModelVariables>(pullModelVariables(
+                            xml->data(), variableChunks, variableChunksEnd, typeDefinitions, numberOfVariables));
+                }
+                XmlPullParser span(xml->data() + begin, xml->data() + end);
+                span.next();
+                return std::shared_ptr<ModelVariables>(pullModelVariables(span, typeDefinitions, numberOfVariables));
+            };
+        }
+
+        if (structureSpan) {
+            const size_t begin = structureSpan->first;
+            const size_t end = structureSpan->second;
+            modelStructureLoader = [xml, begin, end] {
+                XmlPullParser span(xml->data() + begin, xml->data() + end);
+                span.next();
+                return std::shared_ptr<ModelStructure>(pullModelStructure(span));
+            };
+        }
+
+        const ModelDescriptionBase base(guid,
+                                        fmiVersion,
+                                        modelName,
+                                        description,
+                                        version,
+                                        author,
+                                        license,
+                                        copyright,
+                                        generationTool,
+                                        generationDateAndTime,
+                                        variableNamingConvention,
+                                        numberOfEventIndicators,
+                                        numberOfVariables,
+                                        modelVariablesLoader,
+                                        modelStructureLoader,
+                                        defaultExperiment,
+                                        typeDefinitions);
+
+        return std::make_unique<ModelDescription>(base, coSimulation, modelExchange);
+
+    }
+
+    // Errors in ModelVariables or ModelStructure are thrown when the section is first accessed.
+    inline std::unique_ptr<ModelDescription> parseModelDescriptionXml(const std::shared_ptr<const std::string> &xml) {
+        return pullModelDescription(xml);
+    }
+
+    inline std::unique_ptr<ModelDescription> parseModelDescriptionXml(const std::string &xml) {
+        return parseModelDescriptionXml(std::make_shared<const std::string>(xml));
+    }
+
+    inline std::unique_ptr<ModelDescription> parseModelDescription(const std::string &fileName) {
+
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Unable to open '" + fileName + "'!");
+        }
+        std::string xml;
+        file.seekg(0, std::ios::end);
+        xml.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        file.read(&xml[0], xml.size());
+
+        return parseModelDescriptionXml(std::make_shared<const std::string>(std::move(xml)));
+    }
+
 }
 
 #endif //FMI4CPP_MODELDESCRIPTIONPARSER_HPP
@@ -0,0 +1,53 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <fmi4cpp/fmi2/xml/ModelDescriptionReader.hpp>
+
+#include "ModelDescriptionCache.hpp"
+
+using namespace fmi4cpp::fmi2;
+
+std::unique_ptr<ModelDescription> fmi4cpp::fmi2::readModelDescriptionXml(const std::shared_ptr<const std::string> &xml) {
+    return pullModelDescription(xml);
+}
+
+std::unique_ptr<ModelDescription> fmi4cpp::fmi2::readModelDescriptionXml(const std::shared_ptr<const std::string> &xml,
+                                                                         size_t variablesPerChunk) {
+    return pullModelDescription(xml, variablesPerChunk);
+}
+
+std::unique_ptr<ModelDescription> fmi4cpp::fmi2::readModelDescriptionXmlPtree(const std::string &xml) {
+    return parseModelDescriptionPtree(xml);
+}
+
+bool fmi4cpp::fmi2::writeModelDescriptionCacheFile(const ModelDescription &md, const std::string &xmlHash,
+                                                   const std::string &cacheFile) {
+    return writeModelDescriptionCache(md, xmlHash, cacheFile);
+}
+
+std::unique_ptr<ModelDescription> fmi4cpp::fmi2::readModelDescriptionCacheFile(const std::string &cacheFile,
+                                                                             const std::string &xmlHash,
+                                                                             const std::string &xmlFile) {
+    return readModelDescriptionCache(cacheFile, xmlHash, xmlFile);
+}
@@ -22,20 +22,22 @@
  * THE SOFTWARE.
  */
 
+#include <utility>
+
 #include <fmi4cpp/fmi2/xml/ModelStructure.hpp>
 
 using fmi4cpp::fmi2::Unknown;
 using fmi4cpp::fmi2::ModelStructure;
 
 Unknown::Unknown(const unsigned int index, const std::optional<std::string> &dependenciesKind,
-        const std::optional<std::vector<unsigned int>> &dependencies)
-        : index_(index), dependenciesKind_(dependenciesKind), dependencies_(dependencies) {}
+        std::optional<std::vector<unsigned int>> dependencies)
+        : index_(index), dependenciesKind_(dependenciesKind), dependencies_(std::move(dependencies)) {}
 
-const size_t fmi4cpp::fmi2::Unknown::index() {
+const size_t fmi4cpp::fmi2::Unknown::index() const {
     return index_;
 }
 
-const std::optional<std::string> fmi4cpp::fmi2::Unknown::dependenciesKind() {
+const std::optional<std::string> fmi4cpp::fmi2::Unknown::dependenciesKind() const {
     return dependenciesKind_;
 }
 
@@ -43,9 +45,10 @@ const std::optional<std::vector<unsigned int>> &Unknown::dependencies() const {
     return dependencies_;
 }
 
-ModelStructure::ModelStructure(const std::vector<Unknown> &outputs_, const std::vector<Unknown> &derivatives_,
-                               const std::vector<Unknown> &initialUnknowns_)
-        : outputs_(outputs_), derivatives_(derivatives_), initialUnknowns_(initialUnknowns_) {}
+ModelStructure::ModelStructure(std::vector<Unknown> outputs_, std::vector<Unknown> derivatives_,
+                               std::vector<Unknown> initialUnknowns_)
+        : outputs_(std::move(outputs_)), derivatives_(std::move(derivatives_)),
+          initialUnknowns_(std::move(initialUnknowns_)) {}
 
 const std::vector<Unknown> &ModelStructure::outputs() const {
     return outputs_;
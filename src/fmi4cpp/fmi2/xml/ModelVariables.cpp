@@ -22,40 +22,102 @@
  * THE SOFTWARE.
  */
 
+#include <memory>
+#include <algorithm>
 #include <stdexcept>
 #include <fmi4cpp/fmi2/xml/enums.hpp>
 #include <fmi4cpp/fmi2/xml/ModelVariables.hpp>
 
 using namespace fmi4cpp::fmi2;
 
+namespace {
+
+    const BaseType BASE_TYPES[] = {BaseType::real, BaseType::integer, BaseType::boolean, BaseType::string};
+
+}
+
 ModelVariables::ModelVariables() {}
 
-ModelVariables::ModelVariables(const std::vector<ScalarVariable> &variables): variables_(variables) {}
+ModelVariables::ModelVariables(const std::vector<ScalarVariable> &variables)
+        : variables_(variables), names_(variables_), valueReferences_(variables_) {}
 
-const ScalarVariable &ModelVariables::getByName(const std::string &name) const {
-    for (auto &v : variables_) {
-        if (v.name() == name) {
-            return v;
-        }
+ModelVariables::ModelVariables(std::vector<ScalarVariable> &&variables, const std::shared_ptr<const StringPool> &strings,
+                               const std::shared_ptr<const TypeDefinitions> &types)
+        : variables_(std::move(variables)), strings_(strings), types_(types), names_(variables_),
+          valueReferences_(variables_) {
+    for (auto &variable : variables_) {
+        variable.strings_ = strings_;
+        variable.types_ = types_;
+    }
+}
+
+ModelVariables::ModelVariables(const ModelVariables &other)
+        : variables_(other.variables_), strings_(other.strings_), types_(other.types_), names_(other.names_),
+          valueReferences_(other.valueReferences_) {}
+
+ModelVariables &ModelVariables::operator=(const ModelVariables &other) {
+    if (this != &other) {
+        variables_ = other.variables_;
+        strings_ = other.strings_;
+        types_ = other.types_;
+        names_ = other.names_;
+        valueReferences_ = other.valueReferences_;
+        nameTree_.reset();
+    }
+    return *this;
+}
+
+const std::shared_ptr<const StringPool> &ModelVariables::stringPool() const {
+    return strings_;
+}
+
+const ScalarVariable &ModelVariables::getByName(std::string_view name) const {
+    const auto position = names_.find(name, variables_);
+    if (!position) {
+        throw std::runtime_error("No such variable with name '" + std::string(name) + "'!");
+    }
+    return variables_[*position];
+}
+
+const ScalarVariable &ModelVariables::getByValueReference(const BaseType type, const fmi2ValueReference vr) const {
+    const auto group = getAliasGroup(type, vr);
+    if (group.empty()) {
+        throw std::runtime_error("No such " + to_string(type) + " variable with valueReference '" +
+                                 std::to_string(vr) + "'!");
     }
-    throw std::runtime_error("No such variable with name '" + name + "'!");
+    return group[0];
+}
+
+AliasGroup ModelVariables::getAliasGroup(const BaseType type, const fmi2ValueReference vr) const {
+    return valueReferences_.find(type, vr, variables_);
 }
 
 const ScalarVariable &ModelVariables::getByValueReference(const fmi2ValueReference vr) const {
-    for (const auto &var : variables_) {
-        if (var.valueReference() == vr) {
-            return var;
+    size_t first = variables_.size();
+    for (const auto type : BASE_TYPES) {
+        const auto group = getAliasGroup(type, vr);
+        if (!group.empty()) {
+            first = std::min(first, group.position(0));
         }
     }
-    throw std::runtime_error("No such variable with valueReference '" + std::to_string(vr) + "'!");
+    if (first == variables_.size()) {
+        throw std::runtime_error("No such variable with valueReference '" + std::to_string(vr) + "'!");
+    }
+    return variables_[first];
 }
 
 void ModelVariables::getByValueReference(const fmi2ValueReference vr, std::vector<ScalarVariable> &store) const {
-    for (const auto &var : variables_) {
-        if (var.valueReference() == vr) {
-            store.push_back(var);
+    std::vector<size_t> positions;
+    for (const auto type : BASE_TYPES) {
+        const auto group = getAliasGroup(type, vr);
+        for (size_t i = 0; i < group.size(); i++) {
+            positions.push_back(group.position(i));
         }
     }
+    std::sort(positions.begin(), positions.end());
+    for (const auto position : positions) {
+        store.push_back(variables_[position]);
+    }
 }
 
 void ModelVariables::getByCausality(const Causality causality, std::vector<ScalarVariable> &store) const {
@@ -66,6 +128,26 @@ void ModelVariables::getByCausality(const Causality causality, std::vector<Scala
     }
 }
 
+FilteredVariables<HasCausality> ModelVariables::getByCausality(const Causality causality) const {
+    return filter(HasCausality{causality});
+}
+
+const NameTree &ModelVariables::nameTree() const {
+    auto tree = std::atomic_load(&nameTree_);
+    if (!tree) {
+        // when several threads race, the first tree stored is kept and the others are dropped
+        auto built = std::make_shared<const NameTree>(variables_);
+        if (std::atomic_compare_exchange_strong(&nameTree_, &tree, built)) {
+            tree = built;
+        }
+    }
+    return *tree;
+}
+
+std::vector<uint32_t> ModelVariables::select(std::string_view pattern) const {
+    return nameTree().select(pattern);
+}
+
 size_t ModelVariables::size() const {
     return variables_.size();
 }
@@ -87,6 +169,6 @@ std::vector<ScalarVariable>::const_iterator ModelVariables::end() const {
     return variables_.end();
 }
 
-const std::vector<ScalarVariable> ModelVariables::variables() const {
+const std::vector<ScalarVariable> &ModelVariables::variables() const {
     return variables_;
 }
@@ -0,0 +1,91 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <functional>
+
+#include <fmi4cpp/fmi2/xml/NameIndex.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    uint64_t hashName(std::string_view name) {
+        return std::hash<std::string_view>()(name);
+    }
+
+    // independent of the low bits used for the slot, so that it tells colliding names apart
+    uint32_t tagOf(uint64_t hash) {
+        return static_cast<uint32_t>(hash >> 32);
+    }
+
+}
+
+NameIndex::NameIndex(const std::vector<ScalarVariable> &variables) {
+
+    // at most half full, which keeps probe sequences short
+    size_t capacity = 16;
+    while (capacity < variables.size() * 2) {
+        capacity *= 2;
+    }
+    slots_.assign(capacity, Slot{0, 0});
+
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < variables.size(); i++) {
+        const std::string_view name = variables[i].name();
+        const uint64_t hash = hashName(name);
+        const uint32_t tag = tagOf(hash);
+        size_t slot = hash & mask;
+        while (true) {
+            Slot &s = slots_[slot];
+            if (s.position == 0) {
+                s.tag = tag;
+                s.position = static_cast<uint32_t>(i + 1);
+                break;
+            }
+            if (s.tag == tag && variables[s.position - 1].name() == name) {
+                break; // duplicate name, the first declaration wins
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+}
+
+std::optional<size_t> NameIndex::find(std::string_view name, const std::vector<ScalarVariable> &variables) const {
+    if (slots_.empty()) {
+        return std::nullopt;
+    }
+    const size_t mask = slots_.size() - 1;
+    const uint64_t hash = hashName(name);
+    const uint32_t tag = tagOf(hash);
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        const Slot &s = slots_[slot];
+        if (s.position == 0) {
+            return std::nullopt;
+        }
+        if (s.tag == tag && variables[s.position - 1].name() == name) {
+            return s.position - 1;
+        }
+    }
+}
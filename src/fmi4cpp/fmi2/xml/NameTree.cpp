@@ -0,0 +1,294 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <numeric>
+#include <algorithm>
+
+#include <fmi4cpp/fmi2/xml/NameTree.hpp>
+
+#include "../../tools/number_parser.hpp"
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    const std::string_view ANY_COMPONENTS = "**";
+
+    bool isIndex(std::string_view component) {
+        return component.front() == '[';
+    }
+
+    bool isGlob(std::string_view component) {
+        return component.find_first_of("*?") != std::string_view::npos;
+    }
+
+    bool startsWith(std::string_view str, std::string_view prefix) {
+        return str.substr(0, prefix.size()) == prefix;
+    }
+
+    // '*' matches any run of characters, '?' a single one
+    bool globMatch(std::string_view pattern, std::string_view str) {
+        size_t p = 0, s = 0;
+        size_t star = std::string_view::npos, retry = 0;
+        while (s < str.size()) {
+            if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == str[s])) {
+                p++;
+                s++;
+            } else if (p < pattern.size() && pattern[p] == '*') {
+                star = p++;
+                retry = s;
+            } else if (star != std::string_view::npos) {
+                p = star + 1;
+                s = ++retry;
+            } else {
+                return false;
+            }
+        }
+        while (p < pattern.size() && pattern[p] == '*') {
+            p++;
+        }
+        return p == pattern.size();
+    }
+
+    // one index of a pattern: a number, '*', or a range with optional bounds
+    bool indexMatch(std::string_view pattern, std::string_view index) {
+        pattern = trimXmlWhitespace(pattern);
+        index = trimXmlWhitespace(index);
+        if (pattern == "*") {
+            return true;
+        }
+        const auto colon = pattern.find(':');
+        long value;
+        if (colon == std::string_view::npos || !parseNumber(index, value)) {
+            return pattern == index;
+        }
+        long bound;
+        const auto lower = pattern.substr(0, colon);
+        const auto upper = pattern.substr(colon + 1);
+        if (!trimXmlWhitespace(lower).empty() && (!parseNumber(lower, bound) || value < bound)) {
+            return false;
+        }
+        return trimXmlWhitespace(upper).empty() || (parseNumber(upper, bound) && value <= bound);
+    }
+
+    // both are bracketed, comma separated index lists
+    bool indicesMatch(std::string_view pattern, std::string_view indices) {
+        pattern = pattern.substr(1, pattern.size() - (pattern.back() == ']' ? 2 : 1));
+        indices = indices.substr(1, indices.size() - (indices.back() == ']' ? 2 : 1));
+        while (true) {
+            const auto p = pattern.find(',');
+            const auto i = indices.find(',');
+            if ((p == std::string_view::npos) != (i == std::string_view::npos)) {
+                return false;
+            }
+            if (!indexMatch(pattern.substr(0, p), indices.substr(0, i))) {
+                return false;
+            }
+            if (p == std::string_view::npos) {
+                return true;
+            }
+            pattern.remove_prefix(p + 1);
+            indices.remove_prefix(i + 1);
+        }
+    }
+
+}
+
+void fmi4cpp::fmi2::splitName(std::string_view name, std::vector<std::string_view> &components) {
+    size_t start = 0;
+    size_t depth = 0;
+    bool quoted = false;
+    const auto add = [&](size_t end) {
+        if (end > start) {
+            components.push_back(name.substr(start, end - start));
+        }
+    };
+    for (size_t i = 0; i < name.size(); i++) {
+        const char c = name[i];
+        if (quoted) {
+            if (c == '\\') {
+                i++;
+            } else if (c == '\'') {
+                quoted = false;
+            }
+        } else if (c == '\'') {
+            quoted = true;
+        } else if (c == '(') {
+            depth++;
+        } else if (c == ')') {
+            depth -= depth > 0;
+        } else if (depth == 0 && c == '.') {
+            add(i);
+            start = i + 1;
+        } else if (depth == 0 && c == '[') {
+            add(i);
+            const auto close = name.find(']', i);
+            const size_t end = close == std::string_view::npos ? name.size() : close + 1;
+            components.push_back(name.substr(i, end - i));
+            start = end;
+            i = end - 1;
+        }
+    }
+    add(name.size());
+}
+
+NameTree::NameTree() : nodes_(1, Node{{}, 1, 0, 0}) {}
+
+NameTree::NameTree(const std::vector<ScalarVariable> &variables) {
+
+    const auto size = static_cast<uint32_t>(variables.size());
+    std::vector<std::string_view> components;
+    std::vector<uint32_t> offsets;
+    offsets.reserve(size + 1);
+    offsets.push_back(0);
+    for (const auto &v : variables) {
+        splitName(v.name(), components);
+        offsets.push_back(static_cast<uint32_t>(components.size()));
+    }
+
+    std::vector<uint32_t> order(size);
+    std::iota(order.begin(), order.end(), 0);
+    // stable, so that the first of several variables with the same name wins
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return std::lexicographical_compare(components.begin() + offsets[a], components.begin() + offsets[a + 1],
+                                            components.begin() + offsets[b], components.begin() + offsets[b + 1]);
+    });
+
+    // Walking the names in sorted order creates the nodes depth first, and the children of every node
+    // in sorted order. Only the components that differ from the previous name need new nodes.
+    std::vector<uint32_t> parents{0};
+    std::vector<std::string_view> created{{}};
+    std::vector<uint32_t> positions{0};
+    std::vector<uint32_t> path{0};
+    const std::string_view *previous = nullptr;
+    size_t previousSize = 0;
+    for (const auto i : order) {
+        const auto current = components.data() + offsets[i];
+        const size_t currentSize = offsets[i + 1] - offsets[i];
+        size_t common = 0;
+        while (common < currentSize && common < previousSize && current[common] == previous[common]) {
+            common++;
+        }
+        path.resize(common + 1);
+        for (size_t depth = common; depth < currentSize; depth++) {
+            parents.push_back(path.back());
+            created.push_back(current[depth]);
+            positions.push_back(0);
+            path.push_back(static_cast<uint32_t>(parents.size() - 1));
+        }
+        if (currentSize > 0 && positions[path.back()] == 0) {
+            positions[path.back()] = i + 1;
+        }
+        previous = current;
+        previousSize = currentSize;
+    }
+
+    // lay the children of every node out next to each other, keeping their order
+    const size_t count = parents.size();
+    std::vector<uint32_t> numChildren(count, 0);
+    for (size_t node = 1; node < count; node++) {
+        numChildren[parents[node]]++;
+    }
+    std::vector<uint32_t> firstChild(count);
+    uint32_t next = 1;
+    for (size_t node = 0; node < count; node++) {
+        firstChild[node] = next;
+        next += numChildren[node];
+    }
+    std::vector<uint32_t> cursor(firstChild);
+    nodes_.resize(count);
+    nodes_[0] = Node{{}, firstChild[0], numChildren[0], 0};
+    for (size_t node = 1; node < count; node++) {
+        nodes_[cursor[parents[node]]++] = Node{created[node], firstChild[node], numChildren[node], positions[node]};
+    }
+
+}
+
+size_t NameTree::numberOfNodes() const {
+    return nodes_.size();
+}
+
+std::vector<uint32_t> NameTree::select(std::string_view pattern) const {
+    std::vector<std::string_view> components;
+    splitName(pattern, components);
+    std::vector<uint32_t> positions;
+    if (!components.empty()) {
+        select(0, components, 0, positions);
+    }
+    // '**' may reach a variable along several paths
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+    return positions;
+}
+
+void NameTree::select(uint32_t node, const std::vector<std::string_view> &pattern, size_t next,
+                      std::vector<uint32_t> &positions) const {
+
+    const Node &parent = nodes_[node];
+    if (next == pattern.size()) {
+        if (parent.position != 0) {
+            positions.push_back(parent.position - 1);
+        }
+        return;
+    }
+
+    const auto component = pattern[next];
+    const auto first = nodes_.begin() + parent.firstChild;
+    const auto last = first + parent.numChildren;
+    const auto lowerBound = [&](std::string_view key) {
+        return std::lower_bound(first, last, key, [](const Node &n, std::string_view k) {
+            return n.component < k;
+        });
+    };
+    const auto index = [&](std::vector<Node>::const_iterator it) {
+        return static_cast<uint32_t>(it - nodes_.begin());
+    };
+
+    if (component == ANY_COMPONENTS) {
+        select(node, pattern, next + 1, positions);
+        for (auto it = first; it != last; ++it) {
+            select(index(it), pattern, next, positions);
+        }
+    } else if (isIndex(component)) {
+        // index components all start with '[' and so are adjacent
+        for (auto it = lowerBound("["); it != last && isIndex(it->component); ++it) {
+            if (indicesMatch(component, it->component)) {
+                select(index(it), pattern, next + 1, positions);
+            }
+        }
+    } else if (isGlob(component)) {
+        const auto prefix = component.substr(0, component.find_first_of("*?"));
+        for (auto it = lowerBound(prefix); it != last && startsWith(it->component, prefix); ++it) {
+            if (!isIndex(it->component) && globMatch(component, it->component)) {
+                select(index(it), pattern, next + 1, positions);
+            }
+        }
+    } else {
+        const auto it = lowerBound(component);
+        if (it != last && it->component == component) {
+            select(index(it), pattern, next + 1, positions);
+        }
+    }
+
+}
@@ -27,11 +27,11 @@
 
 using namespace fmi4cpp::fmi2;
 
-std::string ScalarVariableBase::name() const {
+std::string_view ScalarVariableBase::name() const {
     return name_;
 }
 
-std::string ScalarVariableBase::description() const {
+std::string_view ScalarVariableBase::description() const {
     return description_;
 }
 
@@ -55,8 +55,8 @@ bool ScalarVariableBase::canHandleMultipleSetPerTimelnstant() const {
     return canHandleMultipleSetPerTimelnstant_;
 }
 
-ScalarVariableBase::ScalarVariableBase(const std::string &name,
-                                       const std::string &description,
+ScalarVariableBase::ScalarVariableBase(std::string_view name,
+                                       std::string_view description,
                                        fmi2ValueReference valueReference,
                                        bool canHandleMultipleSetPerTimelnstant,
                                        Causality causality,
@@ -72,77 +72,113 @@ ScalarVariableBase::ScalarVariableBase(const std::string &name,
 
 ScalarVariable::ScalarVariable(const ScalarVariableBase &base,
                                const IntegerAttribute &integer)
-        : ScalarVariableBase(base), integer_(integer) {}
+        : ScalarVariableBase(base), attribute_(integer) {}
 
 ScalarVariable::ScalarVariable(const ScalarVariableBase &base,
                                const RealAttribute &real)
-        : ScalarVariableBase(base), real_(real) {}
+        : ScalarVariableBase(base), attribute_(real) {}
 
 ScalarVariable::ScalarVariable(const ScalarVariableBase &base,
                                const StringAttribute &string)
-        : ScalarVariableBase(base), string_(string) {}
+        : ScalarVariableBase(base), attribute_(string) {}
 
 ScalarVariable::ScalarVariable(const ScalarVariableBase &base,
                                const BooleanAttribute &boolean)
-        : ScalarVariableBase(base), boolean_(boolean) {}
+        : ScalarVariableBase(base), attribute_(boolean) {}
 
 ScalarVariable::ScalarVariable(const ScalarVariableBase &base,
                                const EnumerationAttribute &enumeration)
-        : ScalarVariableBase(base), enumeration_(enumeration) {}
+        : ScalarVariableBase(base), attribute_(enumeration) {}
 
 
 bool ScalarVariable::isInteger() const {
-    return integer_.has_value();
+    return std::holds_alternative<IntegerAttribute>(attribute_);
 }
 
 bool ScalarVariable::isReal() const {
-    return real_.has_value();
+    return std::holds_alternative<RealAttribute>(attribute_);
 }
 
 bool ScalarVariable::isString() const {
-    return string_.has_value();
+    return std::holds_alternative<StringAttribute>(attribute_);
 }
 
 bool ScalarVariable::isBoolean() const {
-    return boolean_.has_value();
+    return std::holds_alternative<BooleanAttribute>(attribute_);
 }
 
 bool ScalarVariable::isEnumeration() const {
-    return enumeration_.has_value();
+    return std::holds_alternative<EnumerationAttribute>(attribute_);
 }
 
 const IntegerVariable ScalarVariable::asInteger() const {
-    return IntegerVariable(*this, *integer_);
+    return IntegerVariable(*this, std::get<IntegerAttribute>(attribute_));
 }
 
 const RealVariable ScalarVariable::asReal() const {
-    return RealVariable(*this, *real_);
+    return RealVariable(*this, std::get<RealAttribute>(attribute_));
 }
 
 const StringVariable ScalarVariable::asString() const {
-    return StringVariable(*this, *string_);
+    return StringVariable(*this, std::get<StringAttribute>(attribute_));
 }
 
 const BooleanVariable ScalarVariable::asBoolean() const {
-    return BooleanVariable(*this, *boolean_);
+    return BooleanVariable(*this, std::get<BooleanAttribute>(attribute_));
 }
 
 const EnumerationVariable ScalarVariable::asEnumeration() const {
-    return EnumerationVariable(*this, *enumeration_);
+    return EnumerationVariable(*this, std::get<EnumerationAttribute>(attribute_));
+}
+
+IntegerVariableView ScalarVariable::asIntegerView() const {
+    return IntegerVariableView(*this, std::get<IntegerAttribute>(attribute_));
+}
+
+RealVariableView ScalarVariable::asRealView() const {
+    return RealVariableView(*this, std::get<RealAttribute>(attribute_));
+}
+
+StringVariableView ScalarVariable::asStringView() const {
+    return StringVariableView(*this, std::get<StringAttribute>(attribute_));
+}
+
+BooleanVariableView ScalarVariable::asBooleanView() const {
+    return BooleanVariableView(*this, std::get<BooleanAttribute>(attribute_));
+}
+
+EnumerationVariableView ScalarVariable::asEnumerationView() const {
+    return EnumerationVariableView(*this, std::get<EnumerationAttribute>(attribute_));
 }
 
 std::string ScalarVariable::typeName() const {
-    if (integer_) {
-        return INTEGER_TYPE;
-    } else if (real_) {
-        return REAL_TYPE;
-    } else if (string_) {
-        return STRING_TYPE;
-    } else if (boolean_) {
-        return BOOLEAN_TYPE;
-    } else if (enumeration_) {
-        return ENUMERATION_TYPE;
-    } else {
-        return "Unknown";
+    switch (type()) {
+        case VariableType::integer:
+            return INTEGER_TYPE;
+        case VariableType::real:
+            return REAL_TYPE;
+        case VariableType::string:
+            return STRING_TYPE;
+        case VariableType::boolean:
+            return BOOLEAN_TYPE;
+        default:
+            return ENUMERATION_TYPE;
+    }
+}
+
+VariableType ScalarVariable::type() const {
+    return static_cast<VariableType>(attribute_.index());
+}
+
+BaseType ScalarVariable::baseType() const {
+    switch (type()) {
+        case VariableType::real:
+            return BaseType::real;
+        case VariableType::boolean:
+            return BaseType::boolean;
+        case VariableType::string:
+            return BaseType::string;
+        default:
+            return BaseType::integer;
     }
 }
@@ -0,0 +1,84 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <fmi4cpp/fmi2/xml/ScalarVariableView.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    const RealType *realType(const RealAttribute &attribute) {
+        return attribute.type && attribute.type->real ? &*attribute.type->real : nullptr;
+    }
+
+    std::optional<std::string_view> view(const std::optional<std::string> &str) {
+        return str ? std::optional<std::string_view>(*str) : std::nullopt;
+    }
+
+}
+
+std::optional<std::string_view> RealVariableView::displayUnit() const {
+    const auto type = realType(*attribute_);
+    return attribute_->displayUnit || !type ? attribute_->displayUnit : view(type->displayUnit);
+}
+
+std::optional<std::string_view> RealVariableView::unit() const {
+    const auto type = realType(*attribute_);
+    return attribute_->unit || !type ? attribute_->unit : view(type->unit);
+}
+
+const Unit *RealVariableView::unitDefinition() const {
+    return attribute_->unitDefinition;
+}
+
+const DisplayUnit *RealVariableView::displayUnitDefinition() const {
+    const auto name = displayUnit();
+    if (!attribute_->unitDefinition || !name) {
+        return nullptr;
+    }
+    return attribute_->unitDefinition->getDisplayUnit(*name);
+}
+
+std::optional<size_t> RealVariableView::derivative() const {
+    return attribute_->derivative;
+}
+
+std::optional<double> RealVariableView::nominal() const {
+    const auto type = realType(*attribute_);
+    return attribute_->nominal || !type ? attribute_->nominal : type->nominal;
+}
+
+bool RealVariableView::relativeQuantity() const {
+    const auto type = realType(*attribute_);
+    return attribute_->relativeQuantity || (type && type->relativeQuantity);
+}
+
+bool RealVariableView::unbounded() const {
+    const auto type = realType(*attribute_);
+    return attribute_->unbounded || (type && type->unbounded);
+}
+
+bool RealVariableView::reinit() const {
+    return attribute_->reinit;
+}
@@ -0,0 +1,94 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstring>
+
+#include <fmi4cpp/fmi2/xml/StringPool.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    const size_t BLOCK_SIZE = 64 * 1024;
+
+}
+
+std::string_view StringPool::intern(std::string_view str) {
+
+    if (str.empty()) {
+        return "";
+    }
+
+    const auto it = index_.find(str);
+    if (it != index_.end()) {
+        return *it;
+    }
+
+    char *data;
+    if (str.size() > BLOCK_SIZE / 4) {
+        blocks_.emplace_back(new char[str.size()]);
+        data = blocks_.back().get();
+    } else {
+        if (str.size() > available_) {
+            blocks_.emplace_back(new char[BLOCK_SIZE]);
+            next_ = blocks_.back().get();
+            available_ = BLOCK_SIZE;
+        }
+        data = next_;
+        next_ += str.size();
+        available_ -= str.size();
+    }
+
+    std::memcpy(data, str.data(), str.size());
+    bytes_ += str.size();
+    return *index_.emplace(data, str.size()).first;
+}
+
+std::optional<std::string_view> StringPool::intern(const std::optional<std::string_view> &str) {
+    if (!str) {
+        return std::nullopt;
+    }
+    return intern(*str);
+}
+
+void StringPool::merge(StringPool &&other) {
+    blocks_.reserve(blocks_.size() + other.blocks_.size());
+    for (auto &block : other.blocks_) {
+        blocks_.push_back(std::move(block));
+    }
+    bytes_ += other.bytes_;
+    other.blocks_.clear();
+    other.next_ = nullptr;
+    other.available_ = 0;
+    other.bytes_ = 0;
+    other.index_.clear();
+}
+
+void StringPool::shrinkToFit() {
+    std::unordered_set<std::string_view>().swap(index_);
+}
+
+size_t StringPool::bytes() const {
+    return bytes_;
+}
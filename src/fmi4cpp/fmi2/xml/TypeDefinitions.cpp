@@ -0,0 +1,86 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <fmi4cpp/fmi2/xml/TypeDefinitions.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+const EnumerationItem *EnumerationType::getItem(int value) const {
+    for (const auto &item : items) {
+        if (item.value == value) {
+            return &item;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<std::string_view> SimpleType::quantity() const {
+    const std::optional<std::string> *quantity = nullptr;
+    if (real) {
+        quantity = &real->quantity;
+    } else if (integer) {
+        quantity = &integer->quantity;
+    } else if (enumeration) {
+        quantity = &enumeration->quantity;
+    }
+    if (quantity == nullptr || !*quantity) {
+        return std::nullopt;
+    }
+    return std::string_view(**quantity);
+}
+
+TypeDefinitions::TypeDefinitions() : units_(std::make_shared<UnitDefinitions>()) {}
+
+TypeDefinitions::TypeDefinitions(const std::vector<SimpleType> &types,
+                                 const std::shared_ptr<const UnitDefinitions> &units)
+        : types_(types), units_(units ? units : std::make_shared<UnitDefinitions>()) {
+    for (size_t i = 0; i < types_.size(); i++) {
+        auto &type = types_[i];
+        if (type.real && type.real->unit) {
+            type.real->unitDefinition = units_->get(*type.real->unit);
+        }
+        index_.emplace(type.name, i);
+    }
+}
+
+size_t TypeDefinitions::size() const {
+    return types_.size();
+}
+
+const SimpleType *TypeDefinitions::get(std::string_view name) const {
+    const auto it = index_.find(name);
+    return it == index_.end() ? nullptr : &types_[it->second];
+}
+
+const std::shared_ptr<const UnitDefinitions> &TypeDefinitions::units() const {
+    return units_;
+}
+
+std::vector<SimpleType>::const_iterator TypeDefinitions::begin() const {
+    return types_.begin();
+}
+
+std::vector<SimpleType>::const_iterator TypeDefinitions::end() const {
+    return types_.end();
+}
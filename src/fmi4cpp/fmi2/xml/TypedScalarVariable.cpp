@@ -40,32 +40,44 @@ bool IntegerVariable::write(FmuWriter &writer, int value) {
 RealVariable::RealVariable(const ScalarVariable &variable, const RealAttribute &attribute)
         : BoundedScalarVariable(variable, attribute) {}
 
-std::optional<std::string> RealVariable::displayUnit() const {
-    return attribute_.displayUnit;
+RealVariableView RealVariable::view() const {
+    return RealVariableView(variable_, attribute_);
 }
 
-std::optional<std::string> RealVariable::unit() const {
-    return attribute_.unit;
+std::optional<std::string_view> RealVariable::displayUnit() const {
+    return view().displayUnit();
+}
+
+std::optional<std::string_view> RealVariable::unit() const {
+    return view().unit();
+}
+
+const Unit *RealVariable::unitDefinition() const {
+    return view().unitDefinition();
+}
+
+const DisplayUnit *RealVariable::displayUnitDefinition() const {
+    return view().displayUnitDefinition();
 }
 
 std::optional<size_t> RealVariable::derivative() const {
-    return attribute_.derivative;
+    return view().derivative();
 }
 
 std::optional<double> RealVariable::nominal() const {
-    return attribute_.nominal;
+    return view().nominal();
 }
 
 bool RealVariable::relativeQuantity() const {
-    return attribute_.relativeQuantity;
+    return view().relativeQuantity();
 }
 
 bool RealVariable::unbounded() const {
-    return attribute_.unbounded;
+    return view().unbounded();
 }
 
 bool RealVariable::reinit() const {
-    return attribute_.reinit;
+    return view().reinit();
 }
 
 bool RealVariable::read(FmuReader &reader, double &ref) {
@@ -0,0 +1,92 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <fmi4cpp/fmi2/xml/UnitDefinitions.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+bool BaseUnit::sameDimension(const BaseUnit &other) const {
+    return kg == other.kg && m == other.m && s == other.s && A == other.A &&
+           K == other.K && mol == other.mol && cd == other.cd && rad == other.rad;
+}
+
+DisplayUnit::DisplayUnit(const std::string &name, double factor, double offset)
+        : name(name), factor(factor), offset(offset) {}
+
+double DisplayUnit::toDisplay(double value) const {
+    return factor * value + offset;
+}
+
+double DisplayUnit::fromDisplay(double value) const {
+    return (value - offset) / factor;
+}
+
+Unit::Unit(const std::string &name, const std::optional<BaseUnit> &baseUnit,
+           const std::vector<DisplayUnit> &displayUnits)
+        : name_(name), baseUnit_(baseUnit), displayUnits_(displayUnits),
+          factor_(baseUnit ? baseUnit->factor : 1), offset_(baseUnit ? baseUnit->offset : 0) {}
+
+const std::string &Unit::name() const {
+    return name_;
+}
+
+const std::optional<BaseUnit> &Unit::baseUnit() const {
+    return baseUnit_;
+}
+
+const std::vector<DisplayUnit> &Unit::displayUnits() const {
+    return displayUnits_;
+}
+
+const DisplayUnit *Unit::getDisplayUnit(std::string_view name) const {
+    for (const auto &displayUnit : displayUnits_) {
+        if (displayUnit.name == name) {
+            return &displayUnit;
+        }
+    }
+    return nullptr;
+}
+
+UnitDefinitions::UnitDefinitions(const std::vector<Unit> &units) : units_(units) {
+    for (size_t i = 0; i < units_.size(); i++) {
+        index_.emplace(units_[i].name(), i);
+    }
+}
+
+size_t UnitDefinitions::size() const {
+    return units_.size();
+}
+
+const Unit *UnitDefinitions::get(std::string_view name) const {
+    const auto it = index_.find(name);
+    return it == index_.end() ? nullptr : &units_[it->second];
+}
+
+std::vector<Unit>::const_iterator UnitDefinitions::begin() const {
+    return units_.begin();
+}
+
+std::vector<Unit>::const_iterator UnitDefinitions::end() const {
+    return units_.end();
+}
@@ -0,0 +1,101 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <fmi4cpp/fmi2/xml/ValueReferenceIndex.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    uint64_t makeKey(BaseType type, fmi2ValueReference vr) {
+        return ((static_cast<uint64_t>(type) << 32) | vr) + 1;
+    }
+
+    size_t slotOf(uint64_t key, size_t mask) {
+        // Fibonacci hashing, consecutive value references would otherwise fill consecutive slots
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+
+}
+
+ValueReferenceIndex::ValueReferenceIndex(const std::vector<ScalarVariable> &variables) {
+
+    size_t capacity = 16;
+    while (capacity < variables.size() * 2) {
+        capacity *= 2;
+    }
+    slots_.assign(capacity, Slot{0, 0});
+    const size_t mask = capacity - 1;
+
+    // first pass: number the groups in order of appearance and count their members
+    std::vector<uint32_t> groupOf(variables.size());
+    std::vector<uint32_t> counts;
+    for (size_t i = 0; i < variables.size(); i++) {
+        const uint64_t key = makeKey(variables[i].baseType(), variables[i].valueReference());
+        size_t slot = slotOf(key, mask);
+        while (slots_[slot].key != 0 && slots_[slot].key != key) {
+            slot = (slot + 1) & mask;
+        }
+        if (slots_[slot].key == 0) {
+            slots_[slot] = Slot{key, static_cast<uint32_t>(counts.size())};
+            counts.push_back(0);
+        }
+        groupOf[i] = slots_[slot].group;
+        counts[groupOf[i]]++;
+    }
+
+    groupOffsets_.resize(counts.size() + 1);
+    groupOffsets_[0] = 0;
+    for (size_t g = 0; g < counts.size(); g++) {
+        groupOffsets_[g + 1] = groupOffsets_[g] + counts[g];
+    }
+
+    // second pass: fill the groups, which keeps declaration order within each of them
+    std::vector<uint32_t> next(groupOffsets_.begin(), groupOffsets_.end() - 1);
+    positions_.resize(variables.size());
+    for (size_t i = 0; i < variables.size(); i++) {
+        positions_[next[groupOf[i]]++] = static_cast<uint32_t>(i);
+    }
+
+}
+
+AliasGroup ValueReferenceIndex::find(BaseType type, fmi2ValueReference vr,
+                                     const std::vector<ScalarVariable> &variables) const {
+    if (!slots_.empty()) {
+        const size_t mask = slots_.size() - 1;
+        const uint64_t key = makeKey(type, vr);
+        for (size_t slot = slotOf(key, mask); slots_[slot].key != 0; slot = (slot + 1) & mask) {
+            if (slots_[slot].key == key) {
+                const uint32_t group = slots_[slot].group;
+                return AliasGroup(variables.data(), positions_.data() + groupOffsets_[group],
+                                  groupOffsets_[group + 1] - groupOffsets_[group]);
+            }
+        }
+    }
+    return AliasGroup(variables.data(), nullptr, 0);
+}
+
+size_t ValueReferenceIndex::numberOfGroups() const {
+    return groupOffsets_.empty() ? 0 : groupOffsets_.size() - 1;
+}
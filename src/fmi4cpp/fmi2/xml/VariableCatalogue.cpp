@@ -0,0 +1,209 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <fmi4cpp/fmi2/xml/ScalarVariableView.hpp>
+#include <fmi4cpp/fmi2/xml/VariableCatalogue.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    // one empty set per enumerator, 'last' being the highest one
+    template<typename E>
+    std::vector<VariableSet> makeSets(E last, size_t size) {
+        return std::vector<VariableSet>(static_cast<size_t>(last) + 1, VariableSet(size));
+    }
+
+    template<typename E>
+    const VariableSet &setOf(const std::vector<VariableSet> &sets, E value) {
+        return sets.at(static_cast<size_t>(value));
+    }
+
+    template<typename T, typename V>
+    void addStart(StartValues<T> &starts, const ScalarVariable &variable, size_t position, const V &value) {
+        starts.valueReferences.push_back(variable.valueReference());
+        starts.values.push_back(value);
+        starts.positions.push_back(static_cast<uint32_t>(position));
+    }
+
+}
+
+VariableCatalogue::VariableCatalogue(const ModelVariables &variables) {
+
+    const size_t size = variables.size();
+    valueReferences_.reserve(size);
+    types_.reserve(size);
+    causalities_.reserve(size);
+    variabilities_.reserve(size);
+    initials_.reserve(size);
+    hasStart_.reserve(size);
+
+    causalitySets_ = makeSets(Causality::unknown, size);
+    variabilitySets_ = makeSets(Variability::unknown, size);
+    initialSets_ = makeSets(Initial::unknown, size);
+    baseTypeSets_ = makeSets(BaseType::string, size);
+
+    // string starts are copied into one buffer, the pointers are taken once it is complete
+    size_t stringBytes = 0;
+    for (const auto &v : variables) {
+        if (v.isString() && v.asStringView().start()) {
+            stringBytes += v.asStringView().start()->size() + 1;
+        }
+    }
+    strings_.reserve(stringBytes);
+    std::vector<size_t> stringOffsets;
+
+    for (size_t i = 0; i < size; i++) {
+
+        const ScalarVariable &v = variables[i];
+        valueReferences_.push_back(v.valueReference());
+        types_.push_back(v.type());
+        causalities_.push_back(v.causality());
+        variabilities_.push_back(v.variability());
+        initials_.push_back(v.initial());
+
+        causalitySets_[static_cast<size_t>(v.causality())].set(i);
+        variabilitySets_[static_cast<size_t>(v.variability())].set(i);
+        initialSets_[static_cast<size_t>(v.initial())].set(i);
+        baseTypeSets_[static_cast<size_t>(v.baseType())].set(i);
+
+        bool hasStart = false;
+        switch (v.type()) {
+            case VariableType::real:
+                if (const auto &start = v.asRealView().start()) {
+                    addStart(realStarts_, v, i, *start);
+                    hasStart = true;
+                }
+                break;
+            case VariableType::integer:
+                if (const auto &start = v.asIntegerView().start()) {
+                    addStart(integerStarts_, v, i, *start);
+                    hasStart = true;
+                }
+                break;
+            case VariableType::enumeration:
+                if (const auto &start = v.asEnumerationView().start()) {
+                    addStart(integerStarts_, v, i, *start);
+                    hasStart = true;
+                }
+                break;
+            case VariableType::boolean:
+                if (const auto &start = v.asBooleanView().start()) {
+                    addStart(booleanStarts_, v, i, *start ? fmi2True : fmi2False);
+                    hasStart = true;
+                }
+                break;
+            case VariableType::string:
+                if (const auto &start = v.asStringView().start()) {
+                    stringOffsets.push_back(strings_.size());
+                    strings_.append(*start);
+                    strings_.push_back('\0');
+                    addStart(stringStarts_, v, i, nullptr);
+                    hasStart = true;
+                }
+                break;
+        }
+        hasStart_.push_back(hasStart);
+
+    }
+
+    for (size_t i = 0; i < stringOffsets.size(); i++) {
+        stringStarts_.values[i] = strings_.data() + stringOffsets[i];
+    }
+
+}
+
+size_t VariableCatalogue::size() const {
+    return valueReferences_.size();
+}
+
+const std::vector<fmi2ValueReference> &VariableCatalogue::valueReferences() const {
+    return valueReferences_;
+}
+
+const std::vector<VariableType> &VariableCatalogue::types() const {
+    return types_;
+}
+
+const std::vector<Causality> &VariableCatalogue::causalities() const {
+    return causalities_;
+}
+
+const std::vector<Variability> &VariableCatalogue::variabilities() const {
+    return variabilities_;
+}
+
+const std::vector<Initial> &VariableCatalogue::initials() const {
+    return initials_;
+}
+
+const std::vector<uint8_t> &VariableCatalogue::hasStart() const {
+    return hasStart_;
+}
+
+const StartValues<fmi2Real> &VariableCatalogue::realStarts() const {
+    return realStarts_;
+}
+
+const StartValues<fmi2Integer> &VariableCatalogue::integerStarts() const {
+    return integerStarts_;
+}
+
+const StartValues<fmi2Boolean> &VariableCatalogue::booleanStarts() const {
+    return booleanStarts_;
+}
+
+const StartValues<fmi2String> &VariableCatalogue::stringStarts() const {
+    return stringStarts_;
+}
+
+const VariableSet &VariableCatalogue::withCausality(const Causality causality) const {
+    return setOf(causalitySets_, causality);
+}
+
+const VariableSet &VariableCatalogue::withVariability(const Variability variability) const {
+    return setOf(variabilitySets_, variability);
+}
+
+const VariableSet &VariableCatalogue::withInitial(const Initial initial) const {
+    return setOf(initialSets_, initial);
+}
+
+const VariableSet &VariableCatalogue::withBaseType(const BaseType type) const {
+    return setOf(baseTypeSets_, type);
+}
+
+std::vector<fmi2ValueReference> VariableCatalogue::valueReferences(const VariableSet &set) const {
+    if (set.size() != size()) {
+        throw std::runtime_error("The variable set does not belong to this catalogue!");
+    }
+    std::vector<fmi2ValueReference> vrs;
+    const auto indices = set.indices();
+    vrs.reserve(indices.size());
+    for (const auto index : indices) {
+        vrs.push_back(valueReferences_[index]);
+    }
+    return vrs;
+}
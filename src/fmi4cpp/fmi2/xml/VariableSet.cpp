@@ -0,0 +1,158 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <fmi4cpp/fmi2/xml/VariableSet.hpp>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    const size_t WORD_BITS = 64;
+
+    size_t popcount(uint64_t word) {
+#ifdef _MSC_VER
+        return static_cast<size_t>(__popcnt64(word));
+#else
+        return static_cast<size_t>(__builtin_popcountll(word));
+#endif
+    }
+
+    // index of the lowest set bit, 'word' must not be zero
+    size_t lowestBit(uint64_t word) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return index;
+#else
+        return static_cast<size_t>(__builtin_ctzll(word));
+#endif
+    }
+
+    void checkSizes(const VariableSet &lhs, const VariableSet &rhs) {
+        if (lhs.size() != rhs.size()) {
+            throw std::runtime_error("Cannot combine variable sets of size " + std::to_string(lhs.size()) +
+                                     " and " + std::to_string(rhs.size()) + "!");
+        }
+    }
+
+}
+
+VariableSet::VariableSet(const size_t size)
+        : words_((size + WORD_BITS - 1) / WORD_BITS, 0), size_(size) {}
+
+size_t VariableSet::size() const {
+    return size_;
+}
+
+size_t VariableSet::count() const {
+    size_t count = 0;
+    for (const auto word : words_) {
+        count += popcount(word);
+    }
+    return count;
+}
+
+bool VariableSet::any() const {
+    for (const auto word : words_) {
+        if (word != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool VariableSet::test(const size_t index) const {
+    return index < size_ && (words_[index / WORD_BITS] >> (index % WORD_BITS) & 1u) != 0;
+}
+
+void VariableSet::set(const size_t index) {
+    words_[index / WORD_BITS] |= uint64_t(1) << (index % WORD_BITS);
+}
+
+VariableSet &VariableSet::operator&=(const VariableSet &other) {
+    checkSizes(*this, other);
+    for (size_t i = 0; i < words_.size(); i++) {
+        words_[i] &= other.words_[i];
+    }
+    return *this;
+}
+
+VariableSet &VariableSet::operator|=(const VariableSet &other) {
+    checkSizes(*this, other);
+    for (size_t i = 0; i < words_.size(); i++) {
+        words_[i] |= other.words_[i];
+    }
+    return *this;
+}
+
+VariableSet &VariableSet::operator-=(const VariableSet &other) {
+    checkSizes(*this, other);
+    for (size_t i = 0; i < words_.size(); i++) {
+        words_[i] &= ~other.words_[i];
+    }
+    return *this;
+}
+
+VariableSet VariableSet::operator~() const {
+    VariableSet complement(size_);
+    for (size_t i = 0; i < words_.size(); i++) {
+        complement.words_[i] = ~words_[i];
+    }
+    // the bits past the last variable stay clear, count() relies on it
+    if (size_ % WORD_BITS != 0) {
+        complement.words_.back() &= (uint64_t(1) << (size_ % WORD_BITS)) - 1;
+    }
+    return complement;
+}
+
+std::vector<uint32_t> VariableSet::indices() const {
+    std::vector<uint32_t> indices;
+    indices.reserve(count());
+    for (size_t i = 0; i < words_.size(); i++) {
+        for (auto word = words_[i]; word != 0; word &= word - 1) {
+            indices.push_back(static_cast<uint32_t>(i * WORD_BITS + lowestBit(word)));
+        }
+    }
+    return indices;
+}
+
+VariableSet fmi4cpp::fmi2::operator&(VariableSet lhs, const VariableSet &rhs) {
+    lhs &= rhs;
+    return lhs;
+}
+
+VariableSet fmi4cpp::fmi2::operator|(VariableSet lhs, const VariableSet &rhs) {
+    lhs |= rhs;
+    return lhs;
+}
+
+VariableSet fmi4cpp::fmi2::operator-(VariableSet lhs, const VariableSet &rhs) {
+    lhs -= rhs;
+    return lhs;
+}
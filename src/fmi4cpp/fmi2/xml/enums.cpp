@@ -27,6 +27,9 @@
 using fmi4cpp::fmi2::Causality;
 using fmi4cpp::fmi2::Variability;
 using fmi4cpp::fmi2::Initial;
+using fmi4cpp::fmi2::VariableType;
+using fmi4cpp::fmi2::BaseType;
+using fmi4cpp::fmi2::DependencyKind;
 
 Causality fmi4cpp::fmi2::parseCausality(const std::string &str) {
     if (str == "calculatedParameter") {
@@ -75,6 +78,20 @@ Initial fmi4cpp::fmi2::parseInitial(const std::string &str) {
 
 }
 
+DependencyKind fmi4cpp::fmi2::parseDependencyKind(const std::string &str) {
+    if (str == "constant") {
+        return DependencyKind::constant;
+    } else if (str == "fixed") {
+        return DependencyKind::fixed;
+    } else if (str == "tunable") {
+        return DependencyKind::tunable;
+    } else if (str == "discrete") {
+        return DependencyKind::discrete;
+    } else {
+        return DependencyKind::dependent;
+    }
+}
+
 const std::string fmi4cpp::fmi2::to_string(Causality causality) {
 
     switch (causality) {
@@ -128,3 +145,49 @@ const std::string fmi4cpp::fmi2::to_string(Initial initial) {
             return "unknown";
     }
 }
+
+const std::string fmi4cpp::fmi2::to_string(VariableType type) {
+    switch (type) {
+        case VariableType::integer:
+            return "Integer";
+        case VariableType::real:
+            return "Real";
+        case VariableType::string:
+            return "String";
+        case VariableType::boolean:
+            return "Boolean";
+        case VariableType::enumeration:
+        default:
+            return "Enumeration";
+    }
+}
+
+const std::string fmi4cpp::fmi2::to_string(BaseType type) {
+    switch (type) {
+        case BaseType::real:
+            return "Real";
+        case BaseType::integer:
+            return "Integer";
+        case BaseType::boolean:
+            return "Boolean";
+        case BaseType::string:
+        default:
+            return "String";
+    }
+}
+
+const std::string fmi4cpp::fmi2::to_string(DependencyKind kind) {
+    switch (kind) {
+        case DependencyKind::constant:
+            return "constant";
+        case DependencyKind::fixed:
+            return "fixed";
+        case DependencyKind::tunable:
+            return "tunable";
+        case DependencyKind::discrete:
+            return "discrete";
+        case DependencyKind::dependent:
+        default:
+            return "dependent";
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_FILE_LOCK_HPP
+#define FMI4CPP_FILE_LOCK_HPP
+
+#include <string>
+#include <memory>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+    // Takes an exclusive advisory lock on 'file', creating it if needed. Returns nullptr if the lock is held
+    // elsewhere, also by another handle in this process. The lock lasts as long as the returned handle, and is
+    // released by the operating system when the process dies, so it never goes stale.
+    // The file may be removed while it is locked, a later lock then applies to the new file.
+    std::shared_ptr<void> tryLockFile(const std::string &file) {
+#ifdef _WIN32
+        // no sharing except deletion, so that the holder can remove the file
+        HANDLE handle = CreateFileA(file.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_DELETE, nullptr,
+                                    OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        return std::shared_ptr<void>(handle, [](HANDLE h) { CloseHandle(h); });
+#else
+        const int fd = open(file.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return nullptr;
+        }
+        // the file may have been removed by its previous holder between open() and flock()
+        struct stat opened{}, current{};
+        if (flock(fd, LOCK_EX | LOCK_NB) != 0 || fstat(fd, &opened) != 0 || stat(file.c_str(), &current) != 0
+            || opened.st_dev != current.st_dev || opened.st_ino != current.st_ino) {
+            close(fd);
+            return nullptr;
+        }
+        return std::shared_ptr<void>(new int(fd), [](void *p) {
+            const auto fd = static_cast<int *>(p);
+            close(*fd);
+            delete fd;
+        });
+#endif
+    }
+
+}
+
+#endif //FMI4CPP_FILE_LOCK_HPP
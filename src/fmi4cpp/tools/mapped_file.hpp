@@ -0,0 +1,128 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_MAPPED_FILE_HPP
+#define FMI4CPP_MAPPED_FILE_HPP
+
+#include <string>
+#include <memory>
+#include <cstddef>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+    // read-only view of a whole file
+    class MappedFile {
+
+    private:
+        const char *data_ = nullptr;
+        size_t size_ = 0;
+
+        MappedFile() = default;
+
+    public:
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        const char *data() const {
+            return data_;
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        // returns nullptr if the file does not exist or cannot be mapped
+        static std::shared_ptr<MappedFile> open(const std::string &fileName) {
+
+            std::shared_ptr<MappedFile> file(new MappedFile());
+
+#ifdef _WIN32
+            HANDLE handle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (handle == INVALID_HANDLE_VALUE) {
+                return nullptr;
+            }
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+                CloseHandle(handle);
+                return nullptr;
+            }
+            HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(handle);
+            if (mapping == nullptr) {
+                return nullptr;
+            }
+            file->data_ = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+            if (file->data_ == nullptr) {
+                return nullptr;
+            }
+            file->size_ = static_cast<size_t>(size.QuadPart);
+#else
+            const int fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return nullptr;
+            }
+            struct stat st{};
+            if (fstat(fd, &st) != 0 || st.st_size == 0) {
+                close(fd);
+                return nullptr;
+            }
+            void *data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (data == MAP_FAILED) {
+                return nullptr;
+            }
+            file->data_ = static_cast<const char *>(data);
+            file->size_ = static_cast<size_t>(st.st_size);
+#endif
+
+            return file;
+        }
+
+        ~MappedFile() {
+            if (data_ != nullptr) {
+#ifdef _WIN32
+                UnmapViewOfFile(data_);
+#else
+                munmap(const_cast<char *>(data_), size_);
+#endif
+            }
+        }
+
+    };
+
+}
+
+#endif //FMI4CPP_MAPPED_FILE_HPP
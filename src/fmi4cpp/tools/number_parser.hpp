@@ -0,0 +1,110 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_NUMBER_PARSER_HPP
+#define FMI4CPP_NUMBER_PARSER_HPP
+
+#include <vector>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
+#include <system_error>
+
+namespace {
+
+    inline bool isXmlWhitespace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    inline std::string_view trimXmlWhitespace(std::string_view str) {
+        while (!str.empty() && isXmlWhitespace(str.front())) {
+            str.remove_prefix(1);
+        }
+        while (!str.empty() && isXmlWhitespace(str.back())) {
+            str.remove_suffix(1);
+        }
+        return str;
+    }
+
+    // Locale independent and allocation free. Surrounding whitespace and a leading '+' are accepted,
+    // anything else that is not part of the number makes the parse fail.
+    template<typename T>
+    bool parseNumber(std::string_view str, T &value) {
+        static_assert(std::is_arithmetic_v<T>);
+        str = trimXmlWhitespace(str);
+        if (str.size() > 1 && str.front() == '+' && str[1] != '-') {
+            str.remove_prefix(1);
+        }
+        const char *end = str.data() + str.size();
+        const auto result = std::from_chars(str.data(), end, value);
+        return result.ec == std::errc() && result.ptr == end;
+    }
+
+    // xs:boolean
+    inline bool parseBoolean(std::string_view str, bool &value) {
+        str = trimXmlWhitespace(str);
+        if (str == "true" || str == "1") {
+            value = true;
+        } else if (str == "false" || str == "0") {
+            value = false;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // Appends the indices of a whitespace or comma separated list such as "1 2 3", stopping at the first
+    // token that is not a number.
+    inline void parseIndexList(std::string_view str, std::vector<unsigned int> &store) {
+
+        const char *pos = str.data();
+        const char *end = pos + str.size();
+
+        size_t count = 0;
+        bool inToken = false;
+        for (const char *p = pos; p != end; p++) {
+            const bool separator = isXmlWhitespace(*p) || *p == ',';
+            count += !separator && !inToken;
+            inToken = !separator;
+        }
+        store.reserve(store.size() + count);
+
+        while (true) {
+            while (pos != end && (isXmlWhitespace(*pos) || *pos == ',')) {
+                pos++;
+            }
+            unsigned int index;
+            const auto result = std::from_chars(pos, end, index);
+            if (result.ec != std::errc()) {
+                return;
+            }
+            store.push_back(index);
+            pos = result.ptr;
+        }
+
+    }
+
+}
+
+#endif //FMI4CPP_NUMBER_PARSER_HPP
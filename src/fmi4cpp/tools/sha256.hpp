@@ -0,0 +1,102 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_SHA256_HPP
+#define FMI4CPP_SHA256_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+
+#include <openssl/evp.h>
+
+namespace {
+
+    class Sha256 {
+
+    private:
+        EVP_MD_CTX *ctx_;
+
+    public:
+        Sha256() : ctx_(EVP_MD_CTX_new()) {
+            if (ctx_ == nullptr || EVP_DigestInit_ex(ctx_, EVP_sha256(), nullptr) != 1) {
+                EVP_MD_CTX_free(ctx_);
+                throw std::runtime_error("Unable to initialize SHA-256 digest!");
+            }
+        }
+
+        Sha256(const Sha256 &) = delete;
+        Sha256 &operator=(const Sha256 &) = delete;
+
+        void update(const void *data, size_t size) {
+            EVP_DigestUpdate(ctx_, data, size);
+        }
+
+        std::string hexdigest() {
+            unsigned char digest[EVP_MAX_MD_SIZE];
+            unsigned int length = 0;
+            EVP_DigestFinal_ex(ctx_, digest, &length);
+
+            const char *hex = "0123456789abcdef";
+            std::string str;
+            str.reserve(length * 2);
+            for (unsigned int i = 0; i < length; i++) {
+                str += hex[digest[i] >> 4];
+                str += hex[digest[i] & 0x0f];
+            }
+            return str;
+        }
+
+        ~Sha256() {
+            EVP_MD_CTX_free(ctx_);
+        }
+
+    };
+
+    std::string sha256(const void *data, size_t size) {
+        Sha256 sha;
+        sha.update(data, size);
+        return sha.hexdigest();
+    }
+
+    std::string sha256File(const std::string &fileName) {
+
+        std::ifstream file(fileName, std::ios::in | std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Unable to open '" + fileName + "' for hashing!");
+        }
+
+        Sha256 sha;
+        std::vector<char> buffer(1 << 16);
+        while (file) {
+            file.read(buffer.data(), buffer.size());
+            sha.update(buffer.data(), static_cast<size_t>(file.gcount()));
+        }
+        return sha.hexdigest();
+    }
+
+}
+
+#endif //FMI4CPP_SHA256_HPP
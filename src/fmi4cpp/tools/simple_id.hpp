@@ -30,12 +30,11 @@
 
 namespace {
 
-    std::random_device rd;
-    std::mt19937 mt(rd());
-    std::uniform_int_distribution<int> dist(0, 9);
-
     const std::string generate_simple_id(const unsigned int len) {
 
+        thread_local std::mt19937 mt(std::random_device{}());
+        std::uniform_int_distribution<int> dist(0, 9);
+
         std::string id;
         for (unsigned int i = 0; i < len; i++) {
             id += std::to_string(dist(mt));
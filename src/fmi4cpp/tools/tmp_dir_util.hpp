@@ -0,0 +1,68 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_TMP_DIR_UTIL_HPP
+#define FMI4CPP_TMP_DIR_UTIL_HPP
+
+#include <string>
+#include <cctype>
+
+#include "simple_id.hpp"
+#include "process_util.hpp"
+
+namespace {
+
+    // The owning pid leads the name, right after a prefix that directories named by older versions
+    // (fmi4cpp_<fmuName>_<id>) never start with, so the owner is never guessed from the FMU name.
+    const std::string TMP_DIR_PREFIX = "fmi4cpp-p";
+
+    // fmi4cpp-p<pid>-<fmuName>-<id>, so that directories left behind by a crashed process can be recognized
+    std::string generateTmpDirName(const std::string &fmuName) {
+        return TMP_DIR_PREFIX + std::to_string(getCurrentPid()) + "-" + fmuName + "-" + generate_simple_id(8);
+    }
+
+    // held locked by the owner for as long as it uses the directory, see tryLockFile
+    const std::string TMP_DIR_LOCK_NAME = ".fmi4cpp.lock";
+
+    bool parseTmpDirOwner(const std::string &dirName, unsigned long &pid) {
+
+        if (dirName.compare(0, TMP_DIR_PREFIX.size(), TMP_DIR_PREFIX) != 0) {
+            return false;
+        }
+
+        unsigned long value = 0;
+        size_t i = TMP_DIR_PREFIX.size();
+        for (; i < dirName.size() && std::isdigit(static_cast<unsigned char>(dirName[i])); i++) {
+            value = value * 10 + (dirName[i] - '0');
+        }
+        if (i == TMP_DIR_PREFIX.size() || i == dirName.size() || dirName[i] != '-') {
+            return false;
+        }
+        pid = value;
+        return true;
+    }
+
+}
+
+#endif //FMI4CPP_TMP_DIR_UTIL_HPP
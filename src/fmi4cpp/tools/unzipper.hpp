@@ -25,64 +25,262 @@
 #ifndef FMI4CPP_UNZIPPER_HPP
 #define FMI4CPP_UNZIPPER_HPP
 
-#include <fstream>
-#include <iostream>
-#include <sstream>
-#include <zip.h>
+#include <new>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdio>
 #include <string>
+#include <algorithm>
+#include <zip.h>
 #include <experimental/filesystem>
 
+#include <fmi4cpp/fmi2/import/ExtractionPolicy.hpp>
+
+#include "thread_joiner.hpp"
+
+#include "os_util.hpp"
+
 namespace fs = std::experimental::filesystem;
 
 namespace {
 
-    bool extractContents(std::string zip_file, std::string tmp_path) {
+    bool shouldExtract(const std::string &entry, fmi4cpp::fmi2::ExtractionPolicy policy) {
+
+        if (policy == fmi4cpp::fmi2::ExtractionPolicy::everything) {
+            return true;
+        }
+
+        const std::string binaries = "binaries/" + getOs() + "/";
+        return entry == "modelDescription.xml"
+               || entry.compare(0, binaries.size(), binaries) == 0
+               || entry.compare(0, 10, "resources/") == 0;
+    }
+
+    const size_t EXTRACT_BUFFER_SIZE = 1 << 20;
+    const size_t EXTRACT_BUFFER_ALIGNMENT = 4096;
+    const zip_uint64_t PARALLEL_EXTRACT_THRESHOLD = 4 << 20;
+
+    struct ZipEntry {
+        zip_uint64_t index;
+        zip_uint64_t size;
+        fs::path path;
+    };
+
+    struct AlignedBufferDeleter {
+        void operator()(char *buffer) const {
+            ::operator delete[](buffer, std::align_val_t(EXTRACT_BUFFER_ALIGNMENT));
+        }
+    };
+
+    typedef std::unique_ptr<char[], AlignedBufferDeleter> AlignedBuffer;
+
+    AlignedBuffer makeAlignedBuffer(size_t size) {
+        return AlignedBuffer(static_cast<char *>(::operator new[](size, std::align_val_t(EXTRACT_BUFFER_ALIGNMENT))));
+    }
+
+    typedef std::function<zip_t *()> ArchiveOpener;
+
+    ArchiveOpener openFile(const std::string &zip_file) {
+        return [zip_file] {
+            return zip_open(zip_file.c_str(), ZIP_RDONLY, nullptr);
+        };
+    }
+
+    ArchiveOpener openBuffer(const void *data, size_t size) {
+        return [data, size] {
+            zip_error_t error;
+            zip_error_init(&error);
+            zip_t *za = nullptr;
+            zip_source_t *source = zip_source_buffer_create(data, size, 0, &error);
+            if (source != nullptr) {
+                za = zip_open_from_source(source, ZIP_RDONLY, &error);
+                if (za == nullptr) {
+                    zip_source_free(source);
+                }
+            }
+            zip_error_fini(&error);
+            return za;
+        };
+    }
+
+    bool copyEntry(zip_t *za, zip_uint64_t index, zip_uint64_t size, FILE *file, char *buffer, size_t bufferSize) {
+
+        zip_file_t *zf = zip_fopen_index(za, index, 0);
+        if (zf == nullptr) {
+            return false;
+        }
+
+        bool success = true;
+        zip_uint64_t sum = 0;
+        while (sum < size) {
+            const zip_int64_t len = zip_fread(zf, buffer, bufferSize);
+            if (len <= 0 || std::fwrite(buffer, 1, static_cast<size_t>(len), file) != static_cast<size_t>(len)) {
+                success = false;
+                break;
+            }
+            sum += len;
+        }
+        zip_fclose(zf);
+
+        return success;
+    }
+
+    bool extractEntry(zip_t *za, const ZipEntry &entry, char *buffer, size_t bufferSize) {
+
+        FILE *file = std::fopen(entry.path.string().c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        std::setvbuf(file, nullptr, _IONBF, 0);
+
+        const bool success = copyEntry(za, entry.index, entry.size, file, buffer, bufferSize);
+        return (std::fclose(file) == 0) && success;
+    }
+
+    bool readEntry(zip_t *za, const std::string &name, std::string &contents) {
+
+        zip_stat_t sb;
+        if (zip_stat(za, name.c_str(), 0, &sb) != 0) {
+            return false;
+        }
+
+        zip_file_t *zf = zip_fopen_index(za, sb.index, 0);
+        if (zf == nullptr) {
+            return false;
+        }
+
+        contents.resize(sb.size);
+        zip_uint64_t sum = 0;
+        while (sum < sb.size) {
+            const zip_int64_t len = zip_fread(zf, &contents[sum], sb.size - sum);
+            if (len <= 0) {
+                break;
+            }
+            sum += len;
+        }
+        zip_fclose(zf);
+
+        return sum == sb.size;
+    }
+
+    bool readEntry(const ArchiveOpener &openArchive, const std::string &name, std::string &contents) {
+
+        zip_t *za = openArchive();
+        if (za == nullptr) {
+            return false;
+        }
+
+        const bool success = readEntry(za, name, contents);
+        zip_discard(za);
+
+        return success;
+    }
+
+    bool extractContents(const ArchiveOpener &openArchive, const std::string &tmp_path,
+                         const std::function<bool(const std::string &)> &filter, unsigned int numThreads = 0,
+                         zip_uint64_t *bytesExtracted = nullptr) {
 
-        int *err = 0;
-        zip *za = zip_open(zip_file.c_str(), 0, err);
+        zip_t *za = openArchive();
         if (za == nullptr) {
             return false;
         }
 
-        struct zip_file *zf;
-        struct zip_stat sb;
+        std::vector<ZipEntry> entries;
+        zip_uint64_t totalSize = 0;
 
-        const int bufferSize = 1000;
-        char *contents = (char *) malloc(sizeof(char) * bufferSize);
-        zip_int64_t sum, len;
-        for (int i = 0; i < zip_get_num_entries(za, 0); i++) {
-            if (zip_stat_index(za, i, 0, &sb) == 0) {
+        zip_stat_t sb;
+        const zip_int64_t numEntries = zip_get_num_entries(za, 0);
+        for (zip_int64_t i = 0; i < numEntries; i++) {
+            if (zip_stat_index(za, i, 0, &sb) != 0) {
+                continue;
+            }
 
-                std::string newFile = tmp_path + "/" + sb.name;
+            const std::string name = sb.name;
+            if (!filter(name)) {
+                continue;
+            }
 
-                if (sb.size == 0) {
-                    fs::create_directories(newFile);
-                } else {
-                    zf = zip_fopen_index(za, i, 0);
+            const fs::path newFile = fs::path(tmp_path) / name;
+            if (name.back() == '/') {
+                fs::create_directories(newFile);
+            } else {
+                fs::create_directories(newFile.parent_path());
+                entries.push_back({static_cast<zip_uint64_t>(i), sb.size, newFile});
+                totalSize += sb.size;
+            }
+        }
 
-                    std::ofstream file;
-                    file.open(newFile, std::ios::out | std::ios::binary);
+        // largest entries first, so that the workers finish at roughly the same time
+        std::sort(entries.begin(), entries.end(), [](const ZipEntry &a, const ZipEntry &b) {
+            return a.size > b.size;
+        });
 
-                    sum = 0;
-                    while (sum != sb.size) {
-                        len = zip_fread(zf, contents, bufferSize);
-                        file.write(contents, len);
-                        sum += len;
-                    }
+        if (numThreads == 0) {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        if (totalSize < PARALLEL_EXTRACT_THRESHOLD) {
+            numThreads = 1;
+        }
+        numThreads = static_cast<unsigned int>(std::min<size_t>(numThreads, entries.size()));
 
-                    file.flush();
-                    file.close();
+        std::atomic<size_t> next(0);
+        std::atomic<bool> success(true);
 
-                    zip_fclose(zf);
+        auto worker = [&](zip_t *archive) {
+            auto buffer = makeAlignedBuffer(EXTRACT_BUFFER_SIZE);
+            size_t i;
+            while (success && (i = next++) < entries.size()) {
+                if (!extractEntry(archive, entries[i], buffer.get(), EXTRACT_BUFFER_SIZE)) {
+                    success = false;
                 }
+            }
+        };
 
+        std::vector<std::thread> threads;
+        try {
+            ThreadJoiner joiner(threads);
+            try {
+                for (unsigned int t = 1; t < numThreads; t++) {
+                    threads.emplace_back([&] {
+                        zip_t *archive = openArchive();
+                        if (archive == nullptr) {
+                            success = false;
+                            return;
+                        }
+                        worker(archive);
+                        zip_discard(archive);
+                    });
+                }
+                worker(za);
+            } catch (...) {
+                // stop the other workers, the joiner then waits for them
+                success = false;
+                throw;
             }
+        } catch (...) {
+            zip_discard(za);
+            throw;
         }
-        free(contents);
-        zip_close(za);
 
-        return true;
+        zip_discard(za);
+
+        if (bytesExtracted != nullptr) {
+            *bytesExtracted = totalSize;
+        }
+
+        return success;
+
+    }
 
+    bool extractContents(const std::string &zip_file, const std::string &tmp_path,
+                         fmi4cpp::fmi2::ExtractionPolicy policy = fmi4cpp::fmi2::ExtractionPolicy::everything,
+                         unsigned int numThreads = 0, zip_uint64_t *bytesExtracted = nullptr) {
+        return extractContents(openFile(zip_file), tmp_path, [policy](const std::string &name) {
+            return shouldExtract(name, policy);
+        }, numThreads, bytesExtracted);
     }
 
 }
@@ -0,0 +1,345 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FMI4CPP_XML_PULL_PARSER_HPP
+#define FMI4CPP_XML_PULL_PARSER_HPP
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+
+    // Minimal non-validating pull parser over an in-memory document.
+    // Text, comments, CDATA, processing instructions and the DOCTYPE are skipped,
+    // an empty element <a/> is reported as a start element followed by an end element.
+    class XmlPullParser {
+
+    public:
+
+        enum Event {
+            START_ELEMENT, END_ELEMENT, END_DOCUMENT
+        };
+
+        XmlPullParser(const char *begin, const char *end) : pos_(begin), tagStart_(begin), begin_(begin), end_(end) {}
+
+        // attributes are only collected when readAttributes is set
+        Event next(bool readAttributes = true) {
+
+            if (pendingEnd_) {
+                pendingEnd_ = false;
+                depth_--;
+                return END_ELEMENT;
+            }
+
+            while (true) {
+
+                pos_ = static_cast<const char *>(std::memchr(pos_, '<', end_ - pos_));
+                if (pos_ == nullptr) {
+                    pos_ = end_;
+                    if (depth_ != 0) {
+                        fail("unexpected end of document");
+                    }
+                    return END_DOCUMENT;
+                }
+                tagStart_ = pos_;
+
+                if (startsWith("<!--")) {
+                    skipPast("-->");
+                } else if (startsWith("<![CDATA[")) {
+                    skipPast("]]>");
+                } else if (startsWith("<?")) {
+                    skipPast("?>");
+                } else if (startsWith("<!")) {
+                    skipDeclaration();
+                } else if (startsWith("</")) {
+                    pos_ += 2;
+                    name_ = readName();
+                    skipWhitespace();
+                    expect('>');
+                    if (--depth_ < 0) {
+                        fail("unbalanced end tag");
+                    }
+                    return END_ELEMENT;
+                } else {
+                    pos_++;
+                    if (readAttributes) {
+                        readStartTag();
+                    } else {
+                        skipStartTag();
+                    }
+                    depth_++;
+                    return START_ELEMENT;
+                }
+            }
+
+        }
+
+        // name of the current start or end element
+        std::string_view name() const {
+            return name_;
+        }
+
+        int depth() const {
+            return depth_;
+        }
+
+        // offset of the '<' that opened the current tag
+        size_t tagOffset() const {
+            return tagStart_ - begin_;
+        }
+
+        // offset just past the last consumed tag
+        size_t offset() const {
+            return pos_ - begin_;
+        }
+
+        // raw (not yet unescaped) value of an attribute of the current start element
+        const std::string_view *rawAttribute(std::string_view name) const {
+            for (const auto &attribute : attributes_) {
+                if (attribute.first == name) {
+                    return &attribute.second;
+                }
+            }
+            return nullptr;
+        }
+
+        // consumes everything up to and including the end of the current element
+        void skipElement() {
+            const int depth = depth_;
+            while (depth_ >= depth) {
+                if (next(false) == END_DOCUMENT) {
+                    fail("unexpected end of document");
+                }
+            }
+        }
+
+        [[noreturn]] void fail(const std::string &msg) const {
+            throw std::runtime_error("XML parse error at offset " + std::to_string(pos_ - begin_) + ": " + msg);
+        }
+
+        static std::string unescape(std::string_view raw) {
+
+            std::string result;
+            result.reserve(raw.size());
+
+            size_t i = 0;
+            while (i < raw.size()) {
+                const size_t amp = raw.find('&', i);
+                if (amp == std::string_view::npos) {
+                    result.append(raw.substr(i));
+                    break;
+                }
+                result.append(raw.substr(i, amp - i));
+
+                const size_t semicolon = raw.find(';', amp);
+                if (semicolon == std::string_view::npos) {
+                    throw std::runtime_error("XML parse error: unterminated entity reference");
+                }
+                const std::string_view entity = raw.substr(amp + 1, semicolon - amp - 1);
+                if (entity == "amp") {
+                    result += '&';
+                } else if (entity == "lt") {
+                    result += '<';
+                } else if (entity == "gt") {
+                    result += '>';
+                } else if (entity == "quot") {
+                    result += '"';
+                } else if (entity == "apos") {
+                    result += '\'';
+                } else if (entity.size() > 1 && entity[0] == '#') {
+                    const bool hex = entity[1] == 'x';
+                    appendUtf8(result, std::stoul(std::string(entity.substr(hex ? 2 : 1)), nullptr, hex ? 16 : 10));
+                } else {
+                    throw std::runtime_error("XML parse error: unknown entity '&" + std::string(entity) + ";'");
+                }
+                i = semicolon + 1;
+            }
+
+            return result;
+        }
+
+    private:
+
+        const char *pos_;
+        const char *tagStart_;
+        const char *begin_;
+        const char *end_;
+
+        int depth_ = 0;
+        bool pendingEnd_ = false;
+
+        std::string_view name_;
+        std::vector<std::pair<std::string_view, std::string_view>> attributes_;
+
+        static bool isWhitespace(char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        static bool isNameChar(char c) {
+            return !isWhitespace(c) && c != '>' && c != '/' && c != '=' && c != '<' && c != '"' && c != '\'';
+        }
+
+        static void appendUtf8(std::string &out, unsigned long cp) {
+            if (cp < 0x80) {
+                out += static_cast<char>(cp);
+            } else if (cp < 0x800) {
+                out += static_cast<char>(0xC0 | (cp >> 6));
+                out += static_cast<char>(0x80 | (cp & 0x3F));
+            } else if (cp < 0x10000) {
+                out += static_cast<char>(0xE0 | (cp >> 12));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (cp & 0x3F));
+            } else {
+                out += static_cast<char>(0xF0 | (cp >> 18));
+                out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+        }
+
+        bool startsWith(const char *prefix) const {
+            const size_t len = std::strlen(prefix);
+            return static_cast<size_t>(end_ - pos_) >= len && std::memcmp(pos_, prefix, len) == 0;
+        }
+
+        void skipPast(std::string_view terminator) {
+            const std::string_view rest(pos_, end_ - pos_);
+            const size_t found = rest.find(terminator);
+            if (found == std::string_view::npos) {
+                fail("unterminated markup");
+            }
+            pos_ += found + terminator.size();
+        }
+
+        void skipDeclaration() {
+            // <!DOCTYPE ...> may contain an internal subset in square brackets
+            int brackets = 0;
+            for (; pos_ < end_; pos_++) {
+                if (*pos_ == '[') {
+                    brackets++;
+                } else if (*pos_ == ']') {
+                    brackets--;
+                } else if (*pos_ == '>' && brackets == 0) {
+                    pos_++;
+                    return;
+                }
+            }
+            fail("unterminated declaration");
+        }
+
+        void skipWhitespace() {
+            while (pos_ < end_ && isWhitespace(*pos_)) {
+                pos_++;
+            }
+        }
+
+        void expect(char c) {
+            if (pos_ >= end_ || *pos_ != c) {
+                fail(std::string("expected '") + c + "'");
+            }
+            pos_++;
+        }
+
+        std::string_view readName() {
+            const char *start = pos_;
+            while (pos_ < end_ && isNameChar(*pos_)) {
+                pos_++;
+            }
+            if (pos_ == start) {
+                fail("expected name");
+            }
+            return std::string_view(start, pos_ - start);
+        }
+
+        void skipStartTag() {
+
+            name_ = readName();
+            attributes_.clear();
+
+            char quote = 0;
+            for (; pos_ < end_; pos_++) {
+                if (quote != 0) {
+                    if (*pos_ == quote) {
+                        quote = 0;
+                    }
+                } else if (*pos_ == '"' || *pos_ == '\'') {
+                    quote = *pos_;
+                } else if (*pos_ == '>') {
+                    pendingEnd_ = pos_[-1] == '/';
+                    pos_++;
+                    return;
+                }
+            }
+            fail("unterminated start tag");
+
+        }
+
+        void readStartTag() {
+
+            name_ = readName();
+            attributes_.clear();
+
+            while (true) {
+                skipWhitespace();
+                if (pos_ >= end_) {
+                    fail("unterminated start tag");
+                }
+                if (*pos_ == '>') {
+                    pos_++;
+                    return;
+                }
+                if (*pos_ == '/') {
+                    pos_++;
+                    expect('>');
+                    pendingEnd_ = true;
+                    return;
+                }
+
+                const std::string_view name = readName();
+                skipWhitespace();
+                expect('=');
+                skipWhitespace();
+                if (pos_ >= end_ || (*pos_ != '"' && *pos_ != '\'')) {
+                    fail("expected quoted attribute value");
+                }
+                const char quote = *pos_++;
+                const char *valueEnd = static_cast<const char *>(std::memchr(pos_, quote, end_ - pos_));
+                if (valueEnd == nullptr) {
+                    fail("unterminated attribute value");
+                }
+                attributes_.emplace_back(name, std::string_view(pos_, valueEnd - pos_));
+                pos_ = valueEnd + 1;
+            }
+
+        }
+
+    };
+
+}
+
+#endif //FMI4CPP_XML_PULL_PARSER_HPP
@@ -0,0 +1,123 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE CleanupService_Test
+
+#include <string>
+#include <chrono>
+#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <boost/test/unit_test.hpp>
+
+#include <fmi4cpp/tools/os_util.hpp>
+#include <fmi4cpp/fmi2/fmi4cpp.hpp>
+#include <fmi4cpp/fmi2/import/CleanupService.hpp>
+
+using namespace std;
+using namespace fmi4cpp::fmi2;
+
+namespace {
+
+    size_t countOwnTmpDirs() {
+        const string prefix = "fmi4cpp-p" + to_string(getpid()) + "-";
+        size_t count = 0;
+        for (const auto &entry : fs::directory_iterator(fs::temp_directory_path())) {
+            const string name = entry.path().filename().string();
+            if (name.compare(0, prefix.size(), prefix) == 0) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE(CleanupService_test1) {
+
+    const string fmu_path = string(getenv("TEST_FMUs"))
+                            + "/2.0/cs/" + getOs() +
+                            "/20sim/4.6.4.8004/ControlledTemperature/ControlledTemperature.fmu";
+
+    CleanupService::instance().flush();
+    const size_t before = countOwnTmpDirs();
+
+    {
+        Fmu fmu(fmu_path);
+        BOOST_CHECK_EQUAL(before + 1, countOwnTmpDirs());
+    }
+
+    CleanupService::instance().flush();
+    BOOST_CHECK_EQUAL(before, countOwnTmpDirs());
+
+}
+
+BOOST_AUTO_TEST_CASE(CleanupService_test2) {
+
+    const auto dir = fs::temp_directory_path() / "fmi4cpp-sweep-test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    const auto stale = dir / "fmi4cpp-p999999999-Some_Model_3-12345678";
+    const auto alive = dir / ("fmi4cpp-p" + to_string(getpid()) + "-Some_Model-12345678");
+    const auto unrelated = dir / "fmi4cpp-pNoPid-12345678";
+    // older versions named their directories fmi4cpp_<fmuName>_<id>, the owner cannot be told from those
+    const auto legacy = dir / "fmi4cpp_Plant_3_12345678";
+    // the pid looks dead, but the directory is too young, or its owner still holds the lock
+    const auto fresh = dir / "fmi4cpp-p999999999-Fresh-12345678";
+    const auto locked = dir / "fmi4cpp-p999999999-Locked-12345678";
+    fs::create_directories(stale / "binaries");
+    fs::create_directories(alive);
+    fs::create_directories(unrelated);
+    fs::create_directories(legacy);
+    fs::create_directories(fresh);
+    fs::create_directories(locked);
+    ofstream(stale / "modelDescription.xml") << "<fmiModelDescription/>";
+
+    const int lockFd = open((locked / ".fmi4cpp.lock").c_str(), O_RDWR | O_CREAT, 0644);
+    BOOST_REQUIRE(lockFd >= 0);
+    BOOST_REQUIRE_EQUAL(0, flock(lockFd, LOCK_EX));
+
+    const auto hourAgo = fs::file_time_type::clock::now() - chrono::hours(1);
+    fs::last_write_time(stale, hourAgo);
+    fs::last_write_time(locked, hourAgo);
+
+    BOOST_CHECK_EQUAL(1, CleanupService::instance().sweepStale(dir));
+    BOOST_CHECK(!fs::exists(stale));
+    BOOST_CHECK(fs::exists(alive));
+    BOOST_CHECK(fs::exists(unrelated));
+    BOOST_CHECK(fs::exists(legacy));
+    BOOST_CHECK(fs::exists(fresh));
+    BOOST_CHECK(fs::exists(locked));
+
+    // swept once its owner is gone
+    close(lockFd);
+    fs::last_write_time(locked, hourAgo);
+    BOOST_CHECK_EQUAL(1, CleanupService::instance().sweepStale(dir));
+    BOOST_CHECK(!fs::exists(locked));
+
+    fs::remove_all(dir);
+
+}
@@ -26,6 +26,8 @@
 
 
 #include <string>
+#include <vector>
+#include <fstream>
 #include <iostream>
 #include <boost/test/unit_test.hpp>
 
@@ -57,6 +59,24 @@ BOOST_AUTO_TEST_CASE(ControlledTemperature_test1) {
     BOOST_CHECK_EQUAL(2, numOutputs);
 
     auto slave = fmu->newInstance();
+
+    const auto &report = fmu->loadReport();
+    BOOST_CHECK_EQUAL(120, report.numVariables);
+    BOOST_CHECK(report.bytesExtracted > 0);
+    BOOST_CHECK(report.unzip > LoadReport::duration::zero());
+    BOOST_CHECK(report.parse > LoadReport::duration::zero());
+    BOOST_CHECK(report.dlopen > LoadReport::duration::zero());
+    BOOST_CHECK(report.total() >= report.unzip + report.parse);
+    BOOST_CHECK(!report.libraryReused);
+
+    // a second instance shares the library and spends no time loading it
+    {
+        auto other = fmu->newInstance();
+        BOOST_CHECK(report.libraryReused);
+        BOOST_CHECK(report.dlopen == LoadReport::duration::zero());
+        BOOST_CHECK(report.dlsym == LoadReport::duration::zero());
+    }
+
     BOOST_CHECK(slave->setupExperiment());
     BOOST_CHECK(slave->enterInitializationMode());
     BOOST_CHECK(slave->exitInitializationMode());
@@ -69,4 +89,74 @@ BOOST_AUTO_TEST_CASE(ControlledTemperature_test1) {
 
     BOOST_CHECK(slave->terminate());
     
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(ControlledTemperature_test2) {
+
+    const string fmu_path = string(getenv("TEST_FMUs"))
+                            + "/2.0/cs/" + getOs() +
+                            "/20sim/4.6.4.8004/ControlledTemperature/ControlledTemperature.fmu";
+
+    ifstream file(fmu_path, ios::binary);
+    const vector<uint8_t> data((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+
+    auto fmu = Fmu(data, "ControlledTemperature.fmu").asCoSimulationFmu();
+    BOOST_CHECK_EQUAL("ControlledTemperature", fmu->getModelDescription()->modelIdentifier());
+
+    auto slave = fmu->newInstance();
+    BOOST_CHECK(slave->setupExperiment());
+    BOOST_CHECK(slave->enterInitializationMode());
+    BOOST_CHECK(slave->exitInitializationMode());
+
+    double ref;
+    for (int i = 0; i < 10; i++) {
+        BOOST_CHECK(slave->doStep(step_size));
+        BOOST_CHECK(slave->readReal(vr, ref));
+    }
+
+    BOOST_CHECK(slave->terminate());
+
+}
+
+BOOST_AUTO_TEST_CASE(ControlledTemperature_test3) {
+
+    const string fmu_path = string(getenv("TEST_FMUs"))
+                            + "/2.0/cs/" + getOs() +
+                            "/20sim/4.6.4.8004/ControlledTemperature/ControlledTemperature.fmu";
+
+    const auto cacheDir = fs::temp_directory_path() / "fmi4cpp-extracted-test";
+    fs::remove_all(cacheDir);
+
+    ExtractionCache cache(cacheDir);
+    const auto extracted = cache.acquire(fmu_path);
+    const string fmu_dir = extracted->path().string();
+
+    {
+        auto fmu = Fmu(fmu_dir).asCoSimulationFmu();
+        BOOST_CHECK_EQUAL("ControlledTemperature", fmu->getModelDescription()->modelIdentifier());
+
+        auto slave = fmu->newInstance();
+        BOOST_CHECK(slave->setupExperiment());
+        BOOST_CHECK(slave->enterInitializationMode());
+        BOOST_CHECK(slave->exitInitializationMode());
+        BOOST_CHECK(slave->doStep(step_size));
+        BOOST_CHECK(slave->terminate());
+    }
+
+    BOOST_CHECK(fs::exists(fmu_dir + "/modelDescription.xml"));
+
+    // a relative path with a trailing '/' is made absolute
+    const auto cwd = fs::current_path();
+    fs::current_path(extracted->path().parent_path());
+    Fmu relative(extracted->path().filename().string() + "/");
+    fs::current_path(cwd);
+    BOOST_CHECK_EQUAL(extracted->path().filename().string(), relative.getFmuFileName());
+    {
+        auto slave = relative.asCoSimulationFmu()->newInstance();
+        BOOST_CHECK(slave->setupExperiment());
+        BOOST_CHECK(slave->terminate());
+    }
+
+    fs::remove_all(cacheDir);
+
+}
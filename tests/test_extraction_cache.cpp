@@ -0,0 +1,222 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE ExtractionCache_Test
+
+#include <string>
+#include <fstream>
+#include <unistd.h>
+#include <boost/test/unit_test.hpp>
+#include <fmi4cpp/tools/os_util.hpp>
+#include <fmi4cpp/fmi2/fmi4cpp.hpp>
+
+using namespace std;
+using namespace fmi4cpp::fmi2;
+
+const string fmu_path = string(getenv("TEST_FMUs"))
+                        + "/2.0/cs/" + getOs() +
+                        "/20sim/4.6.4.8004/ControlledTemperature/ControlledTemperature.fmu";
+
+BOOST_AUTO_TEST_CASE(ExtractionCache_test1) {
+
+    const auto cacheDir = fs::temp_directory_path() / "fmi4cpp-cache-test";
+    fs::remove_all(cacheDir);
+
+    ExtractionCache cache(cacheDir);
+
+    {
+        Fmu fmu1(fmu_path, cache);
+        Fmu fmu2(fmu_path, cache);
+        BOOST_CHECK_EQUAL(fmu1.guid(), fmu2.guid());
+        BOOST_CHECK_EQUAL(fmu1.getModelDescriptionXml(), fmu2.getModelDescriptionXml());
+
+        size_t numEntries = 0;
+        for (const auto &entry : fs::directory_iterator(cacheDir)) {
+            if (fs::is_directory(entry.status()) && entry.path().extension().empty()) {
+                numEntries++;
+            }
+        }
+        BOOST_CHECK_EQUAL(1, numEntries);
+
+        auto slave = fmu1.asCoSimulationFmu()->newInstance();
+        BOOST_CHECK(slave->setupExperiment());
+        BOOST_CHECK(slave->terminate());
+    }
+
+    // lock files left behind, here naming a live process, do not block the entries
+    for (const auto &entry : fs::directory_iterator(cacheDir)) {
+        if (fs::is_directory(entry.status()) && entry.path().extension().empty()) {
+            ofstream(entry.path().string() + ".lock") << getpid();
+        }
+    }
+    {
+        Fmu fmu(fmu_path, cache);
+        BOOST_CHECK_EQUAL(120, fmu.getModelDescription()->modelVariables()->size());
+    }
+
+    ExtractionCache tinyCache(cacheDir, 0);
+    {
+        Fmu fmu(fmu_path, tinyCache);
+        tinyCache.evict();
+        BOOST_CHECK_EQUAL(120, fmu.getModelDescription()->modelVariables()->size());
+    }
+    tinyCache.evict();
+
+    size_t remaining = 0;
+    for (const auto &entry : fs::directory_iterator(cacheDir)) {
+        if (fs::is_directory(entry.status()) && entry.path().extension().empty()) {
+            remaining++;
+        }
+    }
+    BOOST_CHECK_EQUAL(0, remaining);
+
+    fs::remove_all(cacheDir);
+
+}
+
+BOOST_AUTO_TEST_CASE(ExtractionPolicy_test1) {
+
+    const auto cacheDir = fs::temp_directory_path() / "fmi4cpp-cache-test";
+    fs::remove_all(cacheDir);
+
+    {
+        ExtractionCache cache(cacheDir);
+        Fmu fmu(fmu_path, cache, ExtractionPolicy::runtimeOnly);
+
+        fs::path entry;
+        for (const auto &p : fs::directory_iterator(cacheDir)) {
+            if (fs::is_directory(p.status()) && p.path().extension().empty()) {
+                entry = p.path();
+            }
+        }
+
+        BOOST_CHECK(fs::exists(entry / "modelDescription.xml"));
+        BOOST_CHECK(fs::exists(entry / "binaries" / getOs()));
+        BOOST_CHECK(!fs::exists(entry / "sources"));
+        BOOST_CHECK(!fs::exists(entry / "documentation"));
+
+        for (const auto &platform : fs::directory_iterator(entry / "binaries")) {
+            BOOST_CHECK_EQUAL(getOs(), platform.path().filename().string());
+        }
+
+        auto slave = fmu.asCoSimulationFmu()->newInstance();
+        BOOST_CHECK(slave->setupExperiment());
+        BOOST_CHECK(slave->terminate());
+    }
+
+    fs::remove_all(cacheDir);
+
+}
+
+BOOST_AUTO_TEST_CASE(ModelDescriptionCache_test1) {
+
+    const auto cacheDir = fs::temp_directory_path() / "fmi4cpp-cache-test";
+    fs::remove_all(cacheDir);
+
+    ExtractionCache cache(cacheDir);
+
+    // the cache is written when the entry is populated
+    Fmu fmu1(fmu_path, cache);
+    BOOST_CHECK(fmu1.loadReport().parseCached);
+
+    Fmu fmu2(fmu_path, cache);
+    BOOST_CHECK(fmu2.loadReport().parseCached);
+
+    const auto md1 = fmu1.getModelDescription();
+    const auto md2 = fmu2.getModelDescription();
+    BOOST_CHECK_EQUAL(md1->guid(), md2->guid());
+    BOOST_CHECK_EQUAL(md1->numberOfVariables(), md2->numberOfVariables());
+    BOOST_CHECK_EQUAL(md1->defaultExperiment()->stopTime.value(), md2->defaultExperiment()->stopTime.value());
+    BOOST_CHECK_EQUAL(md1->asCoSimulationModelDescription()->modelIdentifier(),
+                      md2->asCoSimulationModelDescription()->modelIdentifier());
+
+    const auto &variables1 = *md1->modelVariables();
+    const auto &variables2 = *md2->modelVariables();
+    BOOST_REQUIRE_EQUAL(variables1.size(), variables2.size());
+    for (size_t i = 0; i < variables1.size(); i++) {
+        BOOST_CHECK_EQUAL(variables1[i].name(), variables2[i].name());
+        BOOST_CHECK_EQUAL(variables1[i].valueReference(), variables2[i].valueReference());
+        BOOST_CHECK_EQUAL(variables1[i].typeName(), variables2[i].typeName());
+        BOOST_CHECK(variables1[i].causality() == variables2[i].causality());
+        if (variables1[i].isReal()) {
+            BOOST_CHECK(variables1[i].asReal().start() == variables2[i].asReal().start());
+            BOOST_CHECK(variables1[i].asReal().unit() == variables2[i].asReal().unit());
+        }
+    }
+
+    const auto &outputs1 = md1->modelStructure()->outputs();
+    const auto &outputs2 = md2->modelStructure()->outputs();
+    BOOST_REQUIRE_EQUAL(outputs1.size(), outputs2.size());
+    for (size_t i = 0; i < outputs1.size(); i++) {
+        BOOST_CHECK_EQUAL(outputs1[i].index(), outputs2[i].index());
+        BOOST_CHECK(outputs1[i].dependencies() == outputs2[i].dependencies());
+    }
+
+    fs::path entry;
+    for (const auto &p : fs::directory_iterator(cacheDir)) {
+        if (fs::is_directory(p.status()) && p.path().extension().empty()) {
+            entry = p.path();
+        }
+    }
+    BOOST_CHECK(fs::exists(entry / "modelDescription.fmi4cpp.bin"));
+
+    // the recorded size of the entry includes the cache file
+    uintmax_t size = 0;
+    for (const auto &p : fs::recursive_directory_iterator(entry)) {
+        if (fs::is_regular_file(p.status())) {
+            size += fs::file_size(p.path());
+        }
+    }
+    uintmax_t recordedSize = 0;
+    ifstream(entry.string() + ".meta") >> recordedSize;
+    BOOST_CHECK_EQUAL(size, recordedSize);
+
+    // directories opened in place are left untouched
+    const auto copyDir = fs::temp_directory_path() / "fmi4cpp-cache-test-copy";
+    fs::remove_all(copyDir);
+    fs::copy(entry, copyDir, fs::copy_options::recursive);
+    fs::remove(copyDir / "modelDescription.fmi4cpp.bin");
+    {
+        Fmu inPlace(copyDir.string());
+        BOOST_CHECK(!inPlace.loadReport().parseCached);
+        BOOST_CHECK_EQUAL(120, inPlace.getModelDescription()->modelVariables()->size());
+    }
+    BOOST_CHECK(!fs::exists(copyDir / "modelDescription.fmi4cpp.bin"));
+    fs::remove_all(copyDir);
+
+    // a changed modelDescription.xml invalidates the cache
+    {
+        ofstream out((entry / "modelDescription.xml").string(), ios::app);
+        out << "\n";
+    }
+    Fmu fmu3(fmu_path, cache);
+    BOOST_CHECK(!fmu3.loadReport().parseCached);
+    BOOST_CHECK_EQUAL(120, fmu3.getModelDescription()->modelVariables()->size());
+
+    Fmu fmu4(fmu_path, cache);
+    BOOST_CHECK(fmu4.loadReport().parseCached);
+
+    fs::remove_all(cacheDir);
+
+}
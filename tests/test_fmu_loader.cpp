@@ -0,0 +1,70 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 Norwegian University of Technology
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING  FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE FmuLoader_Test
+
+#include <string>
+#include <boost/test/unit_test.hpp>
+
+#include <fmi4cpp/tools/os_util.hpp>
+#include <fmi4cpp/fmi2/fmi4cpp.hpp>
+
+using namespace std;
+using namespace fmi4cpp::fmi2;
+
+const string fmu_path1 = string(getenv("TEST_FMUs"))
+                         + "/2.0/cs/" + getOs() +
+                         "/20sim/4.6.4.8004/TorsionBar/TorsionBar.fmu";
+
+const string fmu_path2 = string(getenv("TEST_FMUs"))
+                         + "/2.0/cs/" + getOs() +
+                         "/20sim/4.6.4.8004/ControlledTemperature/ControlledTemperature.fmu";
+
+BOOST_AUTO_TEST_CASE(FmuLoader_test1) {
+
+    auto future = loadFmuAsync(fmu_path2);
+    auto fmu = future.get();
+    BOOST_CHECK_EQUAL("ControlledTemperature", fmu->modelName());
+
+    BOOST_CHECK_THROW(loadFmuAsync("does_not_exist.fmu").get(), runtime_error);
+
+}
+
+BOOST_AUTO_TEST_CASE(FmuLoader_test2) {
+
+    const auto results = loadFmus({fmu_path1, "does_not_exist.fmu", fmu_path2, fmu_path1}, 2);
+    BOOST_REQUIRE_EQUAL(4, results.size());
+
+    BOOST_CHECK(results[0].ok());
+    BOOST_CHECK(!results[1].ok());
+    BOOST_CHECK(!results[1].error.empty());
+    BOOST_CHECK_EQUAL("does_not_exist.fmu", results[1].fmuFile);
+    BOOST_CHECK(results[2].ok());
+    BOOST_CHECK(results[3].ok());
+
+    BOOST_CHECK_EQUAL("TorsionBar", results[0].fmu->modelName());
+    BOOST_CHECK_EQUAL("ControlledTemperature", results[2].fmu->modelName());
+    BOOST_CHECK(results[0].fmu->getModelDescription() != results[3].fmu->getModelDescription());
+
+}
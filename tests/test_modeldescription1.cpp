@@ -102,4 +102,36 @@ BOOST_AUTO_TEST_CASE(ControlledTemperature_test1) {
 
     BOOST_CHECK_EQUAL(count, outputs.size());
 
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(ControlledTemperature_test2) {
+
+    auto md = ModelDescription::fromArchive(fmu_path);
+
+    BOOST_CHECK_EQUAL("{06c2700b-b39c-4895-9151-304ddde28443}", md->guid());
+    BOOST_CHECK_EQUAL("ControlledTemperature", md->asCoSimulationModelDescription()->modelIdentifier());
+    BOOST_CHECK_EQUAL(120, md->modelVariables()->size());
+    BOOST_CHECK_EQUAL(1, md->getValueReference("HeatCapacity1.T0"));
+
+    // equal strings are stored once
+    const char *kelvin = nullptr;
+    size_t numKelvin = 0;
+    for (const auto &v : *md->modelVariables()) {
+        if (v.isReal() && v.asReal().unit() == "K") {
+            const auto unit = *v.asReal().unit();
+            if (kelvin == nullptr) {
+                kelvin = unit.data();
+            }
+            BOOST_CHECK(kelvin == unit.data());
+            numKelvin++;
+        }
+    }
+    BOOST_CHECK_EQUAL(91, numKelvin);
+
+    // copies keep the strings alive after the model description is released
+    const auto temperature = md->modelVariables()->getByName("HeatCapacity1.T0").asReal();
+    md.reset();
+    BOOST_CHECK_EQUAL("HeatCapacity1.T0", temperature.name());
+    BOOST_CHECK_EQUAL("starting temperature", temperature.description());
+
+}
@@ -26,9 +26,13 @@
 
 #include <vector>
 #include <string>
+#include <thread>
+#include <fstream>
+#include <limits>
 #include <boost/test/unit_test.hpp>
 #include <fmi4cpp/tools/os_util.hpp>
 #include <fmi4cpp/fmi2/fmi4cpp.hpp>
+#include <fmi4cpp/fmi2/xml/ModelDescriptionReader.hpp>
 
 using namespace std;
 using namespace fmi4cpp::fmi2;
@@ -54,4 +58,622 @@ BOOST_AUTO_TEST_CASE(FmuExportCrossCompile_test1) {
     BOOST_CHECK_EQUAL(2, derivatives[0].dependencies().value()[0]);
     BOOST_CHECK_EQUAL("dependent", derivatives[0].dependenciesKind().value());
 
+    const auto &graph = md->dependencyGraphs()->derivatives;
+    BOOST_CHECK(graph.dependsOn(3, 2) == DependencyKind::dependent);
+    BOOST_CHECK(!graph.dependsOn(2, 3));
+    BOOST_REQUIRE_EQUAL(1, graph.dependents(2).size());
+    BOOST_CHECK_EQUAL(3, graph.dependents(2)[0]);
+
+}
+
+BOOST_AUTO_TEST_CASE(FmuExportCrossCompile_test2) {
+
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE fmiModelDescription [ <!ELEMENT fmiModelDescription ANY> ]>
+<!-- generated for testing -->
+<fmiModelDescription fmiVersion="2.0" modelName="Pull &amp; Parse" guid="{abc}"
+                     variableNamingConvention='structured' numberOfEventIndicators="2">
+  <CoSimulation modelIdentifier="pull" canBeInstantiatedOnlyOncePerProcess="true" maxOutputDerivativeOrder="1">
+    <SourceFiles><File name="a.c"/><File name="b.c"></File></SourceFiles>
+  </CoSimulation>
+  <DefaultExperiment startTime="0.0" stopTime=" 10 " stepSize="1e-3"/>
+  <VendorAnnotations><Tool name="x"><![CDATA[ <ScalarVariable> ]]></Tool></VendorAnnotations>
+  <ModelVariables>
+    <ScalarVariable name="der(x[1])" valueReference="1" causality="local" description="&lt;x&gt; &#x3b1;">
+      <Real derivative="2" start="-1.5E+2" unit="m/s"/>
+      <Annotations><Tool name="y"/></Annotations>
+    </ScalarVariable>
+    <ScalarVariable name="x[1]" valueReference="2" causality="output" variability="continuous" initial="exact">
+      <Real start="1"/>
+    </ScalarVariable>
+    <ScalarVariable name="n" valueReference="0" causality="parameter" variability="fixed">
+      <Integer start="3" min="0" max="nan"/>
+    </ScalarVariable>
+    <ScalarVariable name="b" valueReference="0" causality="input"><Boolean start="1"/></ScalarVariable>
+    <ScalarVariable name="s" valueReference="0"><String start="a &quot;b&quot;"/></ScalarVariable>
+  </ModelVariables>
+  <ModelStructure>
+    <Outputs><Unknown index="2" dependencies="1 3" dependenciesKind="dependent constant"/></Outputs>
+    <Derivatives><Unknown index="1"/></Derivatives>
+  </ModelStructure>
+</fmiModelDescription>
+)xml";
+
+    const auto pulled = readModelDescriptionXml(make_shared<const string>(xml));
+    const auto reference = readModelDescriptionXmlPtree(xml);
+    const auto chunked = readModelDescriptionXml(make_shared<const string>(xml), 2);
+    BOOST_CHECK_THROW(readModelDescriptionXml(make_shared<const string>(xml), 0), invalid_argument);
+
+    BOOST_CHECK_EQUAL(5, pulled->numberOfVariables());
+    BOOST_CHECK_EQUAL(5, reference->numberOfVariables());
+
+    const auto cs = pulled->asCoSimulationModelDescription();
+    vector<thread> threads;
+    vector<ModelVariables *> seen(4);
+    for (size_t i = 0; i < seen.size(); i++) {
+        threads.emplace_back([&, i] {
+            seen[i] = (i % 2 == 0 ? pulled->modelVariables() : cs->modelVariables()).get();
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    for (const auto mv : seen) {
+        BOOST_CHECK_EQUAL(pulled->modelVariables().get(), mv);
+    }
+
+    for (const auto &md : {pulled.get(), reference.get(), chunked.get()}) {
+
+        BOOST_CHECK_EQUAL("Pull & Parse", md->modelName());
+        BOOST_CHECK_EQUAL("{abc}", md->guid());
+        BOOST_CHECK_EQUAL(2, md->numberOfEventIndicators());
+        BOOST_CHECK_EQUAL(10.0, *md->defaultExperiment()->stopTime);
+
+        const auto cs = md->asCoSimulationModelDescription();
+        BOOST_CHECK_EQUAL("pull", cs->modelIdentifier());
+        BOOST_CHECK(cs->canBeInstantiatedOnlyOncePerProcess());
+        BOOST_CHECK_EQUAL(1, cs->maxOutputDerivativeOrder());
+        BOOST_CHECK_EQUAL(2, cs->sourceFiles().size());
+
+        const auto mv = md->modelVariables();
+        BOOST_REQUIRE_EQUAL(5, mv->size());
+        BOOST_CHECK_EQUAL("der(x[1])", (*mv)[0].name());
+        BOOST_CHECK_EQUAL("<x> \xce\xb1", (*mv)[0].description());
+        BOOST_CHECK_EQUAL(-150.0, *(*mv)[0].asReal().start());
+        BOOST_CHECK_EQUAL(2, *(*mv)[0].asReal().derivative());
+        BOOST_CHECK(Causality::output == (*mv)[1].causality());
+        BOOST_CHECK(Initial::exact == (*mv)[1].initial());
+        BOOST_CHECK_EQUAL(3, *(*mv)[2].asInteger().start());
+        BOOST_CHECK(!(*mv)[2].asInteger().max());
+        BOOST_CHECK_EQUAL(true, *(*mv)[3].asBoolean().start());
+        BOOST_CHECK_EQUAL("a \"b\"", *(*mv)[4].asString().start());
+
+        for (const auto &v : *mv) {
+            BOOST_CHECK_EQUAL(&v, &mv->getByName(v.name()));
+        }
+        BOOST_CHECK_EQUAL(&(*mv)[1], &md->getVariableByName(std::string("x[1]")));
+        BOOST_CHECK_THROW(mv->getByName("der(x[2])"), runtime_error);
+
+        const auto catalogue = md->variableCatalogue();
+        BOOST_REQUIRE_EQUAL(5, catalogue->size());
+        BOOST_CHECK(vector<fmi2ValueReference>({1, 2, 0, 0, 0}) == catalogue->valueReferences());
+        BOOST_CHECK(VariableType::boolean == catalogue->types()[3]);
+        BOOST_CHECK(Causality::output == catalogue->causalities()[1]);
+        BOOST_CHECK(Variability::fixed == catalogue->variabilities()[2]);
+        BOOST_CHECK(Initial::exact == catalogue->initials()[1]);
+        BOOST_CHECK(vector<uint8_t>(5, 1) == catalogue->hasStart());
+        BOOST_CHECK(vector<fmi2Real>({-150.0, 1.0}) == catalogue->realStarts().values);
+        BOOST_CHECK(vector<fmi2ValueReference>({1, 2}) == catalogue->realStarts().valueReferences);
+        BOOST_CHECK_EQUAL(3, catalogue->integerStarts().values.at(0));
+        BOOST_CHECK_EQUAL(fmi2True, catalogue->booleanStarts().values.at(0));
+        BOOST_CHECK_EQUAL(3, catalogue->booleanStarts().positions.at(0));
+        BOOST_CHECK_EQUAL(string("a \"b\""), catalogue->stringStarts().values.at(0));
+
+        const auto outputs = md->modelStructure()->outputs();
+        BOOST_REQUIRE_EQUAL(1, outputs.size());
+        BOOST_CHECK_EQUAL(2, outputs[0].dependencies()->size());
+        BOOST_CHECK_EQUAL(3, outputs[0].dependencies()->at(1));
+        BOOST_CHECK_EQUAL(1, md->modelStructure()->derivatives().size());
+
+    }
+
+    BOOST_CHECK_THROW(readModelDescriptionXml(make_shared<const string>(xml.substr(0, xml.size() / 2))), runtime_error);
+
+    // an error in a section is reported when the section is first accessed, the document is not parsed again
+    const string broken = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="broken" guid="{broken}">
+  <ModelVariables>
+    <ScalarVariable valueReference="1"><Real/></ScalarVariable>
+  </ModelVariables>
+</fmiModelDescription>
+)xml";
+    const auto md = readModelDescriptionXml(make_shared<const string>(broken));
+    BOOST_CHECK_EQUAL("broken", md->modelName());
+    BOOST_CHECK_EXCEPTION(md->modelVariables(), runtime_error, [](const runtime_error &ex) {
+        return string(ex.what()).find("missing attribute 'name' on <ScalarVariable>") != string::npos;
+    });
+
+}
+
+BOOST_AUTO_TEST_CASE(TypeDefinitions_test1) {
+
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="types" guid="{types}">
+  <CoSimulation modelIdentifier="types"/>
+  <UnitDefinitions>
+    <Unit name="K"><BaseUnit K="1"/><DisplayUnit name="degC" offset="-273.15"/></Unit>
+    <Unit name="degF"><BaseUnit K="1" factor="0.5555555555555556" offset="255.3722222222222"/></Unit>
+    <Unit name="1"/>
+  </UnitDefinitions>
+  <TypeDefinitions>
+    <SimpleType name="Temperature" description="absolute temperature">
+      <Real quantity="ThermodynamicTemperature" unit="K" displayUnit="degC" min="0" nominal="300"/>
+    </SimpleType>
+    <SimpleType name="Count"><Integer quantity="Count" min="0" max="10"/></SimpleType>
+    <SimpleType name="Mode">
+      <Enumeration><Item name="off" value="1"/><Item name="on" value="2" description="running"/></Enumeration>
+    </SimpleType>
+  </TypeDefinitions>
+  <ModelVariables>
+    <ScalarVariable name="T" valueReference="1"><Real declaredType="Temperature" start="300"/></ScalarVariable>
+    <ScalarVariable name="TF" valueReference="2"><Real declaredType="Temperature" unit="degF" max="500"/></ScalarVariable>
+    <ScalarVariable name="n" valueReference="3"><Integer declaredType="Count" max="5"/></ScalarVariable>
+    <ScalarVariable name="mode" valueReference="4"><Enumeration declaredType="Mode" start="2"/></ScalarVariable>
+    <ScalarVariable name="x" valueReference="5"><Real declaredType="Undefined"/></ScalarVariable>
+  </ModelVariables>
+  <ModelStructure/>
+</fmiModelDescription>
+)xml";
+
+    const auto pulled = readModelDescriptionXml(make_shared<const string>(xml));
+    const auto reference = readModelDescriptionXmlPtree(xml);
+
+    const auto cacheFile = (fs::temp_directory_path() / "fmi4cpp-types-test.bin").string();
+    BOOST_REQUIRE(writeModelDescriptionCacheFile(*pulled, "hash", cacheFile));
+    BOOST_CHECK(!readModelDescriptionCacheFile(cacheFile, "other"));
+    const auto cached = readModelDescriptionCacheFile(cacheFile, "hash");
+    BOOST_REQUIRE(cached);
+
+    for (const auto &md : {pulled.get(), reference.get(), cached.get()}) {
+
+        BOOST_REQUIRE_EQUAL(3, md->unitDefinitions()->size());
+        BOOST_REQUIRE_EQUAL(3, md->typeDefinitions()->size());
+
+        const auto kelvin = md->unitDefinitions()->get("K");
+        BOOST_REQUIRE(kelvin);
+        BOOST_CHECK_EQUAL(1, kelvin->baseUnit()->K);
+        BOOST_CHECK_CLOSE(25.0, kelvin->getDisplayUnit("degC")->toDisplay(298.15), 1e-9);
+        BOOST_CHECK_CLOSE(273.15, md->unitDefinitions()->get("degF")->toBase(32), 1e-9);
+        BOOST_CHECK(!md->unitDefinitions()->get("1")->baseUnit());
+
+        const auto mv = md->modelVariables();
+
+        const auto T = (*mv)[0].asReal();
+        BOOST_CHECK_EQUAL(md->typeDefinitions()->get("Temperature"), T.typeDefinition());
+        BOOST_CHECK_EQUAL("ThermodynamicTemperature", *T.quantity());
+        BOOST_CHECK_EQUAL("K", *T.unit());
+        BOOST_CHECK_EQUAL(kelvin, T.unitDefinition());
+        BOOST_CHECK_EQUAL("degC", T.displayUnitDefinition()->name);
+        BOOST_CHECK_EQUAL(0.0, *T.min());
+        BOOST_CHECK(!T.max());
+        BOOST_CHECK_EQUAL(300.0, *T.nominal());
+
+        const auto TF = (*mv)[1].asReal();
+        BOOST_CHECK_EQUAL("degF", *TF.unit());
+        BOOST_CHECK_EQUAL(md->unitDefinitions()->get("degF"), TF.unitDefinition());
+        BOOST_CHECK(!TF.displayUnitDefinition());
+        BOOST_CHECK_EQUAL(500.0, *TF.max());
+
+        const auto n = (*mv)[2].asInteger();
+        BOOST_CHECK_EQUAL(0, *n.min());
+        BOOST_CHECK_EQUAL(5, *n.max());
+        BOOST_CHECK_EQUAL("Count", *n.quantity());
+
+        const auto mode = (*mv)[3].asEnumeration();
+        BOOST_REQUIRE(mode.typeDefinition());
+        BOOST_CHECK_EQUAL("running", *mode.typeDefinition()->enumeration->getItem(*mode.start())->description);
+
+        const auto x = (*mv)[4].asReal();
+        BOOST_CHECK(!x.typeDefinition());
+        BOOST_CHECK(!x.unitDefinition());
+
+        // views resolve the declared type the same way, without copying the variable
+        const auto TView = (*mv)[0].asRealView();
+        BOOST_CHECK_EQUAL(&(*mv)[0], &TView.variable());
+        BOOST_CHECK_EQUAL("K", *TView.unit());
+        BOOST_CHECK_EQUAL("degC", TView.displayUnitDefinition()->name);
+        BOOST_CHECK_EQUAL(0.0, *TView.min());
+        BOOST_CHECK_EQUAL(300.0, *TView.nominal());
+        BOOST_CHECK_EQUAL("Count", *(*mv)[2].asIntegerView().quantity());
+        BOOST_CHECK_EQUAL(*mode.start(), *(*mv)[3].asEnumerationView().start());
+
+    }
+
+    // copied variables keep the type and unit definitions alive after the model description is released
+    vector<unique_ptr<ModelDescription>> released;
+    released.push_back(readModelDescriptionXml(make_shared<const string>(xml)));
+    released.push_back(readModelDescriptionCacheFile(cacheFile, "hash"));
+    for (auto &md : released) {
+        const auto T = md->modelVariables()->getByName("T").asReal();
+        md.reset();
+        BOOST_CHECK_EQUAL(0.0, *T.min());
+        BOOST_CHECK(!T.max());
+        BOOST_CHECK_EQUAL("ThermodynamicTemperature", *T.quantity());
+        BOOST_CHECK_EQUAL("K", *T.unit());
+        BOOST_CHECK_EQUAL("K", T.unitDefinition()->name());
+        BOOST_CHECK_EQUAL("degC", T.displayUnitDefinition()->name);
+        BOOST_CHECK_EQUAL("Temperature", T.typeDefinition()->name);
+    }
+
+    fs::remove(cacheFile);
+
+}
+
+BOOST_AUTO_TEST_CASE(ModelDescriptionCache_corrupt) {
+
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="corrupt" guid="{corrupt}">
+  <CoSimulation modelIdentifier="corrupt"/>
+  <ModelVariables>
+    <ScalarVariable name="x" valueReference="1"><Real start="1"/></ScalarVariable>
+  </ModelVariables>
+  <ModelStructure/>
+</fmiModelDescription>
+)xml";
+
+    const auto cacheFile = (fs::temp_directory_path() / "fmi4cpp-corrupt-test.bin").string();
+    const auto xmlFile = (fs::temp_directory_path() / "fmi4cpp-corrupt-test.xml").string();
+    ofstream(xmlFile) << xml;
+    BOOST_REQUIRE(writeModelDescriptionCacheFile(*readModelDescriptionXml(make_shared<const string>(xml)),
+                                                 "hash", cacheFile));
+
+    // the header stays valid, the variable count after it points past the end of the file
+    {
+        fstream file(cacheFile, ios::in | ios::out | ios::binary);
+        uint64_t variablesOffset = 0;
+        file.seekg(8 + 3 * sizeof(uint32_t) + string("hash").size());
+        file.read(reinterpret_cast<char *>(&variablesOffset), sizeof(variablesOffset));
+        const uint64_t count = numeric_limits<uint64_t>::max();
+        file.seekp(static_cast<streamoff>(variablesOffset));
+        file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    }
+
+    const auto cached = readModelDescriptionCacheFile(cacheFile, "hash");
+    BOOST_REQUIRE(cached);
+    BOOST_CHECK_EQUAL("corrupt", cached->modelName());
+    BOOST_CHECK_EXCEPTION(cached->modelVariables(), runtime_error, [&cacheFile](const runtime_error &ex) {
+        return string(ex.what()) == "Model description cache '" + cacheFile + "' is corrupt!";
+    });
+
+    const auto fallback = readModelDescriptionCacheFile(cacheFile, "hash", xmlFile);
+    BOOST_REQUIRE(fallback);
+    BOOST_REQUIRE_EQUAL(1, fallback->modelVariables()->size());
+    BOOST_CHECK_EQUAL("x", (*fallback->modelVariables())[0].name());
+
+    fs::remove(cacheFile);
+    fs::remove(xmlFile);
+
+}
+
+BOOST_AUTO_TEST_CASE(NumericAttributes_test1) {
+
+    string dependencies;
+    for (unsigned int i = 1; i <= 20000; i++) {
+        dependencies += to_string(i) + (i % 2 == 0 ? "," : " ");
+    }
+
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="numbers" guid="{numbers}" numberOfEventIndicators=" +3 ">
+  <CoSimulation modelIdentifier="numbers"/>
+  <ModelVariables>
+    <ScalarVariable name="a" valueReference="4294967295"><Real start="-1.5e-3" min="+2" max="1e400"/></ScalarVariable>
+    <ScalarVariable name="b" valueReference="1"><Integer start="-7" min="1.5"/></ScalarVariable>
+    <ScalarVariable name="c" valueReference="2"><Boolean start=" 1 "/></ScalarVariable>
+  </ModelVariables>
+  <ModelStructure>
+    <Outputs><Unknown index="1" dependencies=")xml" + dependencies + R"xml("/></Outputs>
+    <InitialUnknowns><Unknown index="2" dependencies="1, 3 x 4"/></InitialUnknowns>
+  </ModelStructure>
+</fmiModelDescription>
+)xml";
+
+    const auto md = readModelDescriptionXml(make_shared<const string>(xml));
+    BOOST_CHECK_EQUAL(3, md->numberOfEventIndicators());
+
+    const auto mv = md->modelVariables();
+    BOOST_CHECK_EQUAL(4294967295u, (*mv)[0].valueReference());
+    BOOST_CHECK_EQUAL(-1.5e-3, *(*mv)[0].asReal().start());
+    BOOST_CHECK_EQUAL(2.0, *(*mv)[0].asReal().min());
+    BOOST_CHECK(!(*mv)[0].asReal().max());
+    BOOST_CHECK_EQUAL(-7, *(*mv)[1].asInteger().start());
+    BOOST_CHECK(!(*mv)[1].asInteger().min());
+    BOOST_CHECK_EQUAL(true, *(*mv)[2].asBoolean().start());
+
+    const auto &outputs = md->modelStructure()->outputs();
+    BOOST_REQUIRE_EQUAL(1, outputs.size());
+    BOOST_REQUIRE_EQUAL(20000, outputs[0].dependencies()->size());
+    BOOST_CHECK_EQUAL(20000, outputs[0].dependencies()->back());
+
+    const auto &initialUnknowns = md->modelStructure()->initialUnknowns();
+    BOOST_REQUIRE_EQUAL(1, initialUnknowns.size());
+    BOOST_CHECK(vector<unsigned int>({1, 3}) == *initialUnknowns[0].dependencies());
+
+}
+
+BOOST_AUTO_TEST_CASE(DependencyGraph_test1) {
+
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="graph" guid="{graph}">
+  <CoSimulation modelIdentifier="graph"/>
+  <ModelVariables>
+    <ScalarVariable name="u1" valueReference="1" causality="input"><Real start="0"/></ScalarVariable>
+    <ScalarVariable name="u2" valueReference="2" causality="input"><Real start="0"/></ScalarVariable>
+    <ScalarVariable name="p" valueReference="3" causality="parameter" variability="fixed"><Real start="1"/></ScalarVariable>
+    <ScalarVariable name="y1" valueReference="4" causality="output"><Real/></ScalarVariable>
+    <ScalarVariable name="y2" valueReference="5" causality="output"><Real/></ScalarVariable>
+    <ScalarVariable name="y3" valueReference="6" causality="output"><Real/></ScalarVariable>
+    <ScalarVariable name="y4" valueReference="7" causality="output"><Real/></ScalarVariable>
+  </ModelVariables>
+  <ModelStructure>
+    <Outputs>
+      <Unknown index="5" dependencies="3 1" dependenciesKind="fixed constant"/>
+      <Unknown index="4" dependencies="1 2"/>
+      <Unknown index="6" dependencies=""/>
+      <Unknown index="7"/>
+    </Outputs>
+  </ModelStructure>
+</fmiModelDescription>
+)xml";
+
+    const auto md = readModelDescriptionXml(make_shared<const string>(xml));
+    const auto graphs = md->dependencyGraphs();
+    BOOST_CHECK_EQUAL(graphs.get(), md->dependencyGraphs().get());
+
+    // a missing dependencies attribute is kept apart from an empty one
+    for (const auto &structure : {md->modelStructure(), readModelDescriptionXmlPtree(xml)->modelStructure()}) {
+        const auto &unknowns = structure->outputs();
+        BOOST_REQUIRE_EQUAL(4, unknowns.size());
+        BOOST_CHECK(unknowns[2].dependencies() && unknowns[2].dependencies()->empty());
+        BOOST_CHECK(!unknowns[3].dependencies());
+    }
+
+    const auto &outputs = graphs->outputs;
+    BOOST_CHECK(vector<unsigned int>({5, 4, 6, 7}) == outputs.unknowns());
+    BOOST_CHECK_EQUAL(4, outputs.numberOfEdges());
+
+    const auto y2 = outputs.dependencies(5);
+    BOOST_REQUIRE_EQUAL(2, y2.size());
+    BOOST_CHECK_EQUAL(1, y2[0]);
+    BOOST_CHECK(DependencyKind::constant == y2.kind(0));
+    BOOST_CHECK_EQUAL(3, y2[1]);
+    BOOST_CHECK(DependencyKind::fixed == y2.kind(1));
+    BOOST_CHECK(outputs.dependencies(6).empty());
+    BOOST_CHECK(outputs.dependencies(100).empty());
+
+    const auto u1 = outputs.dependents(1);
+    BOOST_CHECK(vector<unsigned int>({4, 5}) == vector<unsigned int>(u1.begin(), u1.end()));
+    BOOST_CHECK(DependencyKind::dependent == u1.kind(0));
+    BOOST_CHECK(DependencyKind::constant == u1.kind(1));
+    BOOST_CHECK_EQUAL(1, outputs.dependents(2).size());
+    BOOST_CHECK(outputs.dependents(4).empty());
+
+    BOOST_CHECK(outputs.dependsOn(4, 2) == DependencyKind::dependent);
+    BOOST_CHECK(!outputs.dependsOn(5, 2));
+
+    // y4 depends on all knowns, y3 on none
+    BOOST_CHECK(outputs.dependsOnAllKnowns(7));
+    BOOST_CHECK(!outputs.dependsOnAllKnowns(6));
+    BOOST_CHECK(vector<unsigned int>({7}) == outputs.unknownsDependingOnAllKnowns());
+    BOOST_CHECK(outputs.dependencies(7).empty());
+    BOOST_CHECK(outputs.dependsOn(7, 1) == DependencyKind::dependent);
+    BOOST_CHECK(outputs.dependsOn(7, 2) == DependencyKind::dependent);
+    BOOST_CHECK(!outputs.dependsOn(6, 1));
+
+    BOOST_CHECK(graphs->derivatives.unknowns().empty());
+    BOOST_CHECK(graphs->derivatives.dependents(1).empty());
+
+}
+
+BOOST_AUTO_TEST_CASE(AliasGroups_test1) {
+
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="aliases" guid="{aliases}">
+  <CoSimulation modelIdentifier="aliases"/>
+  <ModelVariables>
+    <ScalarVariable name="flag" valueReference="1"><Boolean start="true"/></ScalarVariable>
+    <ScalarVariable name="x" valueReference="1"><Real start="1"/></ScalarVariable>
+    <ScalarVariable name="n" valueReference="1"><Integer/></ScalarVariable>
+    <ScalarVariable name="x_alias" valueReference="1"><Real/></ScalarVariable>
+    <ScalarVariable name="mode" valueReference="1"><Enumeration declaredType="Mode"/></ScalarVariable>
+    <ScalarVariable name="y" valueReference="2" causality="output"><Real/></ScalarVariable>
+    <ScalarVariable name="x_alias2" valueReference="1"><Real/></ScalarVariable>
+  </ModelVariables>
+  <ModelStructure/>
+</fmiModelDescription>
+)xml";
+
+    const auto md = readModelDescriptionXml(make_shared<const string>(xml));
+    const auto mv = md->modelVariables();
+
+    const auto reals = mv->getAliasGroup(BaseType::real, 1);
+    BOOST_REQUIRE_EQUAL(3, reals.size());
+    vector<string> names;
+    for (const auto &v : reals) {
+        names.emplace_back(v.name());
+    }
+    BOOST_CHECK(vector<string>({"x", "x_alias", "x_alias2"}) == names);
+    BOOST_CHECK_EQUAL(3, reals.position(1));
+
+    // Integer and Enumeration share the value reference space
+    const auto integers = mv->getAliasGroup(BaseType::integer, 1);
+    BOOST_REQUIRE_EQUAL(2, integers.size());
+    BOOST_CHECK_EQUAL("n", integers[0].name());
+    BOOST_CHECK_EQUAL("mode", integers[1].name());
+
+    BOOST_CHECK_EQUAL("flag", mv->getByValueReference(BaseType::boolean, 1).name());
+    BOOST_CHECK_EQUAL("y", mv->getByValueReference(BaseType::real, 2).name());
+    BOOST_CHECK(mv->getAliasGroup(BaseType::string, 1).empty());
+    BOOST_CHECK(mv->getAliasGroup(BaseType::integer, 2).empty());
+    BOOST_CHECK_THROW(mv->getByValueReference(BaseType::string, 1), runtime_error);
+
+    BOOST_CHECK_EQUAL("flag", mv->getByValueReference(1).name());
+    vector<ScalarVariable> all;
+    mv->getByValueReference(1, all);
+    BOOST_REQUIRE_EQUAL(6, all.size());
+    BOOST_CHECK_EQUAL("x", all[1].name());
+    BOOST_CHECK_EQUAL("x_alias2", all[5].name());
+
+}
+
+BOOST_AUTO_TEST_CASE(VariableViews_test1) {
+
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="views" guid="{views}">
+  <CoSimulation modelIdentifier="views"/>
+  <ModelVariables>
+    <ScalarVariable name="u" valueReference="1" causality="input"><Real start="1"/></ScalarVariable>
+    <ScalarVariable name="y1" valueReference="2" causality="output"><Real/></ScalarVariable>
+    <ScalarVariable name="s" valueReference="1"><String start="text"/></ScalarVariable>
+    <ScalarVariable name="y2" valueReference="3" causality="output"><Boolean/></ScalarVariable>
+  </ModelVariables>
+  <ModelStructure/>
+</fmiModelDescription>
+)xml";
+
+    const auto md = readModelDescriptionXml(make_shared<const string>(xml));
+    const auto mv = md->modelVariables();
+
+    BOOST_CHECK_EQUAL(&(*mv)[0], &mv->variables()[0]);
+
+    vector<string> outputs;
+    for (const auto &v : mv->getByCausality(Causality::output)) {
+        BOOST_CHECK_EQUAL(&v, &mv->getByName(v.name()));
+        outputs.emplace_back(v.name());
+    }
+    BOOST_CHECK(vector<string>({"y1", "y2"}) == outputs);
+    BOOST_CHECK_EQUAL(1, mv->getByCausality(Causality::input).count());
+    BOOST_CHECK_EQUAL(0, mv->getByCausality(Causality::parameter).count());
+
+    const auto strings = mv->filter([](const ScalarVariable &v) { return v.isString(); });
+    BOOST_REQUIRE_EQUAL(1, strings.count());
+    const auto s = strings.begin()->asStringView();
+    BOOST_CHECK_EQUAL("text", *s.start());
+    BOOST_CHECK_EQUAL(&*s.start(), &*mv->getByName("s").asStringView().start());
+
+    BOOST_CHECK(VariableType::string == (*mv)[2].type());
+    BOOST_CHECK(VariableType::boolean == (*mv)[3].type());
+    BOOST_CHECK_EQUAL("Boolean", (*mv)[3].typeName());
+    BOOST_CHECK_THROW((*mv)[0].asStringView(), bad_variant_access);
+
+}
+
+BOOST_AUTO_TEST_CASE(VariableSets_test1) {
+
+    // more than two words of bits, with a partial last word
+    string variables;
+    for (unsigned int i = 0; i < 150; i++) {
+        variables += "<ScalarVariable name=\"v" + to_string(i) + "\" valueReference=\"" + to_string(i) + "\"" +
+                     (i % 3 == 0 ? " causality=\"output\"" : " causality=\"local\"") +
+                     (i % 2 == 0 ? " variability=\"continuous\"" : " variability=\"discrete\"") + ">" +
+                     (i % 5 == 0 ? "<Integer/>" : "<Real/>") + "</ScalarVariable>\n";
+    }
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="sets" guid="{sets}">
+  <CoSimulation modelIdentifier="sets"/>
+  <ModelVariables>
+)xml" + variables + R"xml(  </ModelVariables>
+  <ModelStructure/>
+</fmiModelDescription>
+)xml";
+
+    const auto md = readModelDescriptionXml(make_shared<const string>(xml));
+    const auto catalogue = md->variableCatalogue();
+
+    const auto &outputs = catalogue->withCausality(Causality::output);
+    BOOST_CHECK_EQUAL(150, outputs.size());
+    BOOST_CHECK_EQUAL(50, outputs.count());
+    BOOST_CHECK_EQUAL(100, (~outputs).count());
+    BOOST_CHECK(!catalogue->withCausality(Causality::parameter).any());
+
+    const auto continuousRealOutputs = outputs & catalogue->withVariability(Variability::continuous) &
+                                       catalogue->withBaseType(BaseType::real);
+    vector<fmi2ValueReference> expected;
+    for (unsigned int i = 0; i < 150; i++) {
+        if (i % 3 == 0 && i % 2 == 0 && i % 5 != 0) {
+            expected.push_back(i);
+        }
+    }
+    BOOST_CHECK(expected == catalogue->valueReferences(continuousRealOutputs));
+    BOOST_CHECK_EQUAL(expected.size(), continuousRealOutputs.indices().size());
+    BOOST_CHECK(continuousRealOutputs.test(6));
+    BOOST_CHECK(!continuousRealOutputs.test(30));
+
+    const auto integersOrOutputs = outputs | catalogue->withBaseType(BaseType::integer);
+    BOOST_CHECK_EQUAL(50 + 30 - 10, integersOrOutputs.count());
+    BOOST_CHECK_EQUAL(10, (outputs - catalogue->withBaseType(BaseType::real)).count());
+
+    BOOST_CHECK_THROW(outputs & VariableSet(10), runtime_error);
+    BOOST_CHECK_THROW(catalogue->valueReferences(VariableSet(10)), runtime_error);
+
+}
+
+BOOST_AUTO_TEST_CASE(NameTree_test1) {
+
+    const vector<string> names = {
+            "controller.pid.gain", "controller.pi.gain", "controller.pid.offset", "controller.gain",
+            "x[1]", "x[2]", "x[10]", "m[1,2]", "m[2,2]", "plant.der(x.y)", "'a.b'.c", "y[3].z", "y[4].w"};
+    string variables;
+    for (size_t i = 0; i < names.size(); i++) {
+        variables += "<ScalarVariable name=\"" + names[i] + "\" valueReference=\"" + to_string(i) + "\"><Real/></ScalarVariable>\n";
+    }
+    const string xml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<fmiModelDescription fmiVersion="2.0" modelName="tree" guid="{tree}" variableNamingConvention="structured">
+  <CoSimulation modelIdentifier="tree"/>
+  <ModelVariables>
+)xml" + variables + R"xml(  </ModelVariables>
+  <ModelStructure/>
+</fmiModelDescription>
+)xml";
+
+    vector<string_view> components;
+    splitName("a.b[3,1].'c.d'.der(e.f)", components);
+    BOOST_CHECK(vector<string_view>({"a", "b", "[3,1]", "'c.d'", "der(e.f)"}) == components);
+
+    const auto md = readModelDescriptionXml(make_shared<const string>(xml));
+    const auto mv = md->modelVariables();
+    const auto select = [&](const string &pattern) {
+        vector<string> selected;
+        for (const auto position : mv->select(pattern)) {
+            selected.emplace_back((*mv)[position].name());
+        }
+        return selected;
+    };
+
+    BOOST_CHECK(vector<string>({"controller.pid.gain", "controller.pi.gain"}) == select("controller.*.gain"));
+    BOOST_CHECK(vector<string>({"controller.pid.gain", "controller.pid.offset"}) == select("controller.pid.**"));
+    BOOST_CHECK(vector<string>({"controller.pid.gain", "controller.pi.gain", "controller.gain"}) ==
+                select("controller.**.gain"));
+    BOOST_CHECK(vector<string>({"controller.pid.gain"}) == select("controller.pi?.gain"));
+    BOOST_CHECK(vector<string>({"controller.pid.gain"}) == select("controller.pid.gain"));
+    BOOST_CHECK(select("controller.pid").empty());
+    BOOST_CHECK(select("controller.none.gain").empty());
+
+    BOOST_CHECK(vector<string>({"x[2]", "x[10]"}) == select("x[2:10]"));
+    BOOST_CHECK(vector<string>({"x[1]", "x[2]"}) == select("x[:2]"));
+    BOOST_CHECK(vector<string>({"x[1]", "x[2]", "x[10]"}) == select("x[*]"));
+    BOOST_CHECK(select("x").empty());
+    BOOST_CHECK(vector<string>({"m[2,2]"}) == select("m[2:,2]"));
+    BOOST_CHECK(select("m[1]").empty());
+    BOOST_CHECK(vector<string>({"y[3].z", "y[4].w"}) == select("y[*].*"));
+
+    BOOST_CHECK(vector<string>({"plant.der(x.y)"}) == select("plant.der(*)"));
+    BOOST_CHECK(vector<string>({"'a.b'.c"}) == select("'a.b'.*"));
+    BOOST_CHECK_EQUAL(names.size(), mv->select("**").size());
+
+    // ModelVariables stays copyable, copies build their own tree
+    ModelVariables copy(*mv);
+    BOOST_CHECK(mv->select("controller.*.gain") == copy.select("controller.*.gain"));
+    copy = ModelVariables();
+    BOOST_CHECK(copy.select("**").empty());
+
 }
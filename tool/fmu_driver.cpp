@@ -61,12 +61,14 @@ int main(int argc, char** argv) {
     desc.add_options()
             ("help,h", "Print this help message and quits.")
             ("me", "Treat FMU as an Model Exchange FMU.")
+            ("timings", "Print how long each phase of loading the FMU took.")
             ("fmu,f", po::value<string>(), "Path to FMU.")
             ("output,o", po::value<string>(), "Where to store the generated CSV results.")
             (START, po::value<double>(), "Start time.")
             (STOP, po::value<double>(), "Stop time.")
             (STEP_SIZE, po::value<double>(), "StepSize.")
-            ("variables,v", po::value<vector<string>>()->multitoken(), "Variables to print.");
+            ("variables,v", po::value<vector<string>>()->multitoken(),
+                    "Variables to print. Accepts patterns like controller.*.gain, a.** or x[2:4].");
 
     if (argc == 1) {
         cout << "fmu_driver" << endl << desc << endl;
@@ -107,9 +109,22 @@ int main(int argc, char** argv) {
 
     DriverOptions options;
 
+    const auto md = fmu->getModelDescription();
     auto variables = vm["variables"].as<vector<string>>();
-    for (const auto v : variables) {
-        options.variables.push_back(fmu->getModelDescription()->getVariableByName(v));
+    for (const auto &v : variables) {
+        if (v.find_first_of("*?:") == string::npos) {
+            options.variables.push_back(md->getVariableByName(v));
+            continue;
+        }
+        const auto mv = md->modelVariables();
+        const auto selected = mv->select(v);
+        if (selected.empty()) {
+            cerr << "No variables match '" << v << "'.. Please try again." << endl;
+            return COMMANDLINE_ERROR;
+        }
+        for (const auto position : selected) {
+            options.variables.push_back((*mv)[position]);
+        }
     }
 
     if (vm.count(START)) {
@@ -133,6 +148,10 @@ int main(int argc, char** argv) {
     FmuDriver driver(fmu);
     driver.run(options);
 
+    if (vm.count("timings")) {
+        cout << driver.loadReport();
+    }
+
     return 0;
 
 }
\ No newline at end of file